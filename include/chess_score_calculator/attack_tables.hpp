@@ -0,0 +1,108 @@
+#ifndef CHESS_SCORE_CALCULATOR_ATTACK_TABLES_HPP
+#define CHESS_SCORE_CALCULATOR_ATTACK_TABLES_HPP
+
+////////////////////////////////////////////////////////////////////////////////
+// Standard Libraries
+#include <array>
+#include <utility>
+////////////////////////////////////////////////////////////////////////////////
+// User Defined Libraries
+#include <chess_score_calculator/bitboard.hpp>
+#include <chess_score_calculator/enums.hpp>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace chess {
+
+/// @returns Tiles threatened by a pawn of given side at bit index
+constexpr Bitboard get_pawn_attacks(Side side, int square) noexcept;
+
+/// @returns Tiles threatened by a knight at bit index
+constexpr Bitboard get_knight_attacks(int square) noexcept;
+
+/// @returns Tiles threatened by a king at bit index
+constexpr Bitboard get_king_attacks(int square) noexcept;
+
+} // namespace chess
+
+////////////////////////////////////////////////////////////////////////////////
+// INLINE DEFINITIONS
+////////////////////////////////////////////////////////////////////////////////
+
+namespace chess::attack_tables {
+
+using AttackTable = std::array<Bitboard, 64>;
+
+/**
+Generate the attack table of a piece that jumps to its targets
+
+@param distances Pairs of row_up and col_right values
+@see get_coordinate_at
+*/
+template <size_t N>
+constexpr AttackTable make_leaper_table(const std::array<std::pair<int, int>, N>& distances) noexcept
+{
+    AttackTable result {};
+    for (int square = 0; square < 64; square++) {
+        const int row = square / 8;
+        const int col = square % 8;
+        for (const std::pair<int, int>& distance : distances) {
+            const int target_row = row + distance.first;
+            const int target_col = col + distance.second;
+            if ((0 <= target_row) && (target_row < 8) && (0 <= target_col) && (target_col < 8)) {
+                result[square] |= Bitboard { 1 } << (target_row * 8 + target_col);
+            }
+        }
+    }
+    return result;
+}
+
+/// Indexed by #Side
+inline constexpr std::array<AttackTable, 2> pawn = {
+    make_leaper_table(std::array { std::pair { 1, 1 }, std::pair { 1, -1 } }),
+    make_leaper_table(std::array { std::pair { -1, 1 }, std::pair { -1, -1 } }),
+};
+
+inline constexpr AttackTable knight = make_leaper_table(std::array {
+    std::pair { 1, 2 },
+    std::pair { 1, -2 },
+    std::pair { -1, 2 },
+    std::pair { -1, -2 },
+    std::pair { 2, 1 },
+    std::pair { 2, -1 },
+    std::pair { -2, 1 },
+    std::pair { -2, -1 },
+});
+
+inline constexpr AttackTable king = make_leaper_table(std::array {
+    std::pair { 1, 0 },
+    std::pair { -1, 0 },
+    std::pair { 0, 1 },
+    std::pair { 0, -1 },
+    std::pair { 1, 1 },
+    std::pair { 1, -1 },
+    std::pair { -1, 1 },
+    std::pair { -1, -1 },
+});
+
+} // namespace chess::attack_tables
+
+namespace chess {
+
+constexpr Bitboard get_pawn_attacks(Side side, int square) noexcept
+{
+    return attack_tables::pawn[static_cast<size_t>(side)][square];
+}
+
+constexpr Bitboard get_knight_attacks(int square) noexcept
+{
+    return attack_tables::knight[square];
+}
+
+constexpr Bitboard get_king_attacks(int square) noexcept
+{
+    return attack_tables::king[square];
+}
+
+} // namespace chess
+
+#endif // CHESS_SCORE_CALCULATOR_ATTACK_TABLES_HPP
@@ -0,0 +1,110 @@
+#ifndef CHESS_SCORE_CALCULATOR_BATCH_FILE_LOADER_HPP
+#define CHESS_SCORE_CALCULATOR_BATCH_FILE_LOADER_HPP
+
+////////////////////////////////////////////////////////////////////////////////
+// Standard Libraries
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <span>
+#include <vector>
+////////////////////////////////////////////////////////////////////////////////
+// User Defined Libraries
+#include <chess_score_calculator/bounded_queue.hpp>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace chess {
+
+/**
+Fixed size buffers that files are loaded into, reused instead of allocating a string per file
+
+A buffer is acquired by the loader and released by whoever consumes the content, possibly another thread.
+*/
+class FileBufferPool {
+public:
+    FileBufferPool(size_t num_buffers, size_t buffer_size);
+
+    size_t get_buffer_size() const noexcept
+    {
+        return buffer_size;
+    }
+
+    /// @returns Id of a free buffer, waiting while every buffer is in use
+    std::uint32_t acquire();
+
+    /// @returns Id of a free buffer, empty if every buffer is in use
+    std::optional<std::uint32_t> try_acquire();
+
+    void release(std::uint32_t buffer_id);
+
+    std::span<char> get_buffer(std::uint32_t buffer_id) noexcept
+    {
+        return { memory.get() + (buffer_id * buffer_size), buffer_size };
+    }
+
+private:
+    size_t buffer_size;
+    std::unique_ptr<char[]> memory;
+    BoundedQueue<std::uint32_t> free_buffers;
+};
+
+/// A file loaded into a pool buffer
+struct LoadedFile {
+    std::uint32_t buffer_id;
+    /// Bytes read, equal to the buffer size if the file may be longer than a buffer
+    size_t size;
+    /// errno of opening the file, 0 if opened
+    int open_error;
+    /// errno of reading the file, 0 if read
+    int read_error;
+};
+
+/**
+Loads many small files into pool buffers with few system calls
+
+On Linux the open, read and close of every file of a batch are queued to io_uring and submitted by a
+single system call, as a chain per file on a registered file slot. Elsewhere, or if io_uring cannot be
+set up (e.g. an old kernel or a seccomp filter), the files are read one by one.
+*/
+class BatchFileLoader {
+public:
+    /**
+    @param max_batch_size Number of files loaded by a call at most, i.e. the depth of the io_uring queue
+    @param is_io_uring_requested Whether to try io_uring, otherwise files are read one by one
+    */
+    BatchFileLoader(FileBufferPool& buffer_pool, unsigned max_batch_size, bool is_io_uring_requested);
+
+    ~BatchFileLoader();
+
+    BatchFileLoader(const BatchFileLoader&) = delete;
+    BatchFileLoader& operator=(const BatchFileLoader&) = delete;
+
+    bool is_using_io_uring() const noexcept
+    {
+        return ring != nullptr;
+    }
+
+    /**
+    Load files from their beginning
+
+    Every free buffer up to the batch size is taken, waiting for one if none is free, so fewer files than
+    given may be loaded. The caller releases the buffers of the loaded files, including failed ones.
+    @returns Loaded files in given order
+    @warning Throws if io_uring fails, errors of single files are returned instead
+    */
+    std::vector<LoadedFile> load(std::span<const std::filesystem::path* const> files);
+
+private:
+    struct Ring;
+
+    std::vector<LoadedFile> load_synchronously(std::span<const std::filesystem::path* const> files, std::span<const std::uint32_t> buffer_ids);
+
+    FileBufferPool& buffer_pool;
+    unsigned max_batch_size;
+    std::unique_ptr<Ring> ring;
+};
+
+} // namespace chess
+
+#endif // CHESS_SCORE_CALCULATOR_BATCH_FILE_LOADER_HPP
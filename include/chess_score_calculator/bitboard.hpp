@@ -0,0 +1,71 @@
+#ifndef CHESS_SCORE_CALCULATOR_BITBOARD_HPP
+#define CHESS_SCORE_CALCULATOR_BITBOARD_HPP
+
+////////////////////////////////////////////////////////////////////////////////
+// Standard Libraries
+#include <cstdint>
+////////////////////////////////////////////////////////////////////////////////
+// User Defined Libraries
+#include <chess_score_calculator/enums.hpp>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace chess {
+
+/// Set of tiles with one bit per tile, a1 being the least significant bit and h8 the most significant
+using Bitboard = std::uint64_t;
+
+/// @returns Bit index of the coordinate, i.e. a1 = 0, b1 = 1, ..., h8 = 63
+constexpr int to_square(const Coordinate& coordinate) noexcept;
+
+/// @returns Coordinate of bit index in range [0, 64)
+constexpr Coordinate to_coordinate(int square) noexcept;
+
+/// @returns Bitboard that only contains the coordinate
+constexpr Bitboard to_bitboard(const Coordinate& coordinate) noexcept;
+
+/**
+Remove the least significant tile from a bitboard
+
+@warning Bitboard must not be empty
+@returns Bit index of the removed tile
+*/
+constexpr int pop_square(Bitboard& bitboard) noexcept;
+
+} // namespace chess
+
+////////////////////////////////////////////////////////////////////////////////
+// INLINE DEFINITIONS
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Standard Libraries
+#include <bit>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace chess {
+
+constexpr int to_square(const Coordinate& coordinate) noexcept
+{
+    return static_cast<int>(coordinate.row) * 8 + static_cast<int>(coordinate.col);
+}
+
+constexpr Coordinate to_coordinate(int square) noexcept
+{
+    return Coordinate { static_cast<Row>(square / 8), static_cast<Column>(square % 8) };
+}
+
+constexpr Bitboard to_bitboard(const Coordinate& coordinate) noexcept
+{
+    return Bitboard { 1 } << to_square(coordinate);
+}
+
+constexpr int pop_square(Bitboard& bitboard) noexcept
+{
+    const int square = std::countr_zero(bitboard);
+    bitboard &= bitboard - 1;
+    return square;
+}
+
+} // namespace chess
+
+#endif // CHESS_SCORE_CALCULATOR_BITBOARD_HPP
@@ -0,0 +1,84 @@
+#ifndef CHESS_SCORE_CALCULATOR_BOARD_BATCH_HPP
+#define CHESS_SCORE_CALCULATOR_BOARD_BATCH_HPP
+
+////////////////////////////////////////////////////////////////////////////////
+// Standard Libraries
+#include <array>
+#include <cstddef>
+#include <span>
+#include <string_view>
+#include <vector>
+////////////////////////////////////////////////////////////////////////////////
+// User Defined Libraries
+#include <chess_score_calculator/bitboard.hpp>
+#include <chess_score_calculator/chessboard.hpp>
+#include <chess_score_calculator/enums.hpp>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace chess {
+
+/**
+Many boards in structure of arrays form
+
+There is one array per side and piece type, so the same bitboard of consecutive boards is contiguous
+and a vector register holds the same bitboard of several boards.
+*/
+class BoardBatch {
+public:
+    BoardBatch() = default;
+
+    /// Reserve space for given number of boards
+    void reserve(size_t num_boards);
+
+    /// Append the bitboards of a board
+    void push_back(const Chessboard& chessboard);
+
+    /// Remove all boards, the capacity is kept
+    void clear() noexcept;
+
+    size_t size() const noexcept;
+
+    /// @returns Bitboards of given side and piece type, one per board
+    std::span<const Bitboard> get_bitboards(Side side, PieceType piece_type) const noexcept;
+
+private:
+    /// Indexed by #Side * 6 + #PieceType
+    std::array<std::vector<Bitboard>, 12> bitboards;
+};
+
+/// Instruction set of the batch scoring kernel
+enum class BatchKernel {
+    Scalar,
+    Avx2,
+    Avx512
+};
+
+/// @returns Name of the kernel
+std::string_view to_string(BatchKernel batch_kernel) noexcept;
+
+/// @returns Whether the library and the CPU support given kernel
+bool is_supported(BatchKernel batch_kernel) noexcept;
+
+/// @returns The widest supported kernel, detected once at the first call
+BatchKernel get_batch_kernel() noexcept;
+
+/**
+Score every board of a batch by the widest supported kernel
+
+Each lane of a vector register is a board. The scores are summed as integer half points
+and converted to #Score only when they are written out.
+
+@param scores One per board
+@warning Throws if the number of scores differs from the number of boards
+*/
+void score_batch(const BoardBatch& board_batch, std::span<Score> scores);
+
+/**
+@overload
+@warning Throws if given kernel is not supported
+*/
+void score_batch(const BoardBatch& board_batch, std::span<Score> scores, BatchKernel batch_kernel);
+
+} // namespace chess
+
+#endif // CHESS_SCORE_CALCULATOR_BOARD_BATCH_HPP
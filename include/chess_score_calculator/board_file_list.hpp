@@ -0,0 +1,70 @@
+#ifndef CHESS_SCORE_CALCULATOR_BOARD_FILE_LIST_HPP
+#define CHESS_SCORE_CALCULATOR_BOARD_FILE_LIST_HPP
+
+////////////////////////////////////////////////////////////////////////////////
+// Standard Libraries
+#include <filesystem>
+#include <istream>
+#include <optional>
+#include <string>
+#include <string_view>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace chess {
+
+/**
+Match a filename against a glob pattern
+
+`*` matches any characters, `?` a single character and `[abc]`, `[a-z]` or `[!abc]` a character of a set.
+Every other character matches itself.
+*/
+bool match_glob(std::string_view pattern, std::string_view filename) noexcept;
+
+/**
+Lists the regular files under a directory and its subdirectories one at a time
+
+The files are enumerated as they are requested, so the first ones are scored before a large tree is walked.
+*/
+class DirectoryFileList {
+public:
+    /**
+    @param glob Pattern the filenames must match, see #match_glob
+    @warning Throws if directory is not found
+    */
+    DirectoryFileList(const std::filesystem::path& directory, std::string glob);
+
+    /**
+    @returns Next matching file in directory order, empty if every file is listed
+    @warning Throws if a directory cannot be iterated
+    */
+    std::optional<std::filesystem::path> next();
+
+private:
+    std::filesystem::recursive_directory_iterator it;
+    std::string glob;
+};
+
+/**
+Reads a list of paths from a stream one at a time, e.g. the output of `find` piped to stdin
+
+Paths are separated by line breaks, or by NUL characters if one precedes the first line break as
+with `find -print0`, so that any filename can be listed. Empty entries are ignored.
+*/
+class PathListReader {
+public:
+    /// @param is Must outlive the reader
+    explicit PathListReader(std::istream& is) noexcept;
+
+    /// @returns Next path, empty at the end of the stream
+    std::optional<std::filesystem::path> next();
+
+private:
+    std::istream& is;
+    /// Known after the first entry
+    char separator = '\0';
+    bool is_separator_known = false;
+};
+
+} // namespace chess
+
+#endif // CHESS_SCORE_CALCULATOR_BOARD_FILE_LIST_HPP
@@ -0,0 +1,177 @@
+#ifndef CHESS_SCORE_CALCULATOR_BOARD_FILE_PIPELINE_HPP
+#define CHESS_SCORE_CALCULATOR_BOARD_FILE_PIPELINE_HPP
+
+////////////////////////////////////////////////////////////////////////////////
+// Standard Libraries
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <filesystem>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+////////////////////////////////////////////////////////////////////////////////
+// User Defined Libraries
+#include <chess_score_calculator/batch_file_loader.hpp>
+#include <chess_score_calculator/bounded_queue.hpp>
+#include <chess_score_calculator/chessboard.hpp>
+#include <chess_score_calculator/result_cache.hpp>
+#include <chess_score_calculator/result_writer.hpp>
+#include <chess_score_calculator/score_cache.hpp>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace chess {
+
+/// Parallelism of the board file pipeline, 0 means a share of the number of threads
+struct PipelineOptions {
+    unsigned num_read_threads = 0;
+    unsigned num_parse_threads = 0;
+    unsigned num_score_threads = 0;
+    /// Capacity of the queue between each pair of stages
+    unsigned queue_size = 1024;
+    /// Whether readers load their batches by io_uring, if available
+    bool is_io_uring_requested = false;
+    /// Number of files a reader claims and loads at once
+    unsigned read_batch_size = 1024;
+};
+
+/// A board file passing through the stages of #BoardFilePipeline
+struct BoardFileItem {
+    size_t index = 0;
+    std::filesystem::path board_path;
+    /// Pool buffer of the content, loaded by the reader stage and released by the parser stage
+    std::optional<std::uint32_t> buffer_id;
+    size_t content_size = 0;
+    /// Content of a file longer than a pool buffer
+    std::string content;
+    std::optional<Chessboard> chessboard;
+    /// Set by the first stage that knows it
+    std::optional<Score> score;
+    /// Result cache key, stamp and entry of the file
+    std::string key;
+    std::optional<FileStamp> file_stamp;
+    std::optional<ResultCacheEntry> cached_entry;
+    /// Error of any stage, the later stages pass the item on
+    std::exception_ptr exception;
+};
+
+/**
+Scores board files by a pipeline of reader, parser and scorer stages and writes their rows in input order
+
+Each stage runs on its own threads and passes items to the next one through a bounded lock-free queue,
+so reading files overlaps with parsing and scoring, and a slow stage does not make the others buffer
+every file. A producer thread takes the board paths from the source and hands them to the readers
+through a queue, so listing the files overlaps with reading and scoring, and no reader waits on the
+listing while the queue has paths. The rows are written by the calling thread as soon as the preceding rows are written.
+
+By default the threads are shared out between the stages, a quarter of them reading and the rest split
+between the CPU bound parser and scorer stages. The producer takes no path more than a window ahead of
+the next row to write, so a stalled file holds back at most a window of finished boards.
+*/
+class BoardFilePipeline {
+public:
+    /**
+    @param next_board_path Source of the board paths, empty at the end, called by a single thread at a time
+    @param result_cache Scores of the previous run, unchanged files are neither read nor scored
+    @param num_threads Number of threads shared out between the stages whose thread count is not given
+    @param score_cache Scores of already seen positions, nullptr if disabled
+    */
+    BoardFilePipeline(std::function<std::optional<std::filesystem::path>()> next_board_path, ResultCache* result_cache, const PipelineOptions& options, unsigned num_threads, ScoreCache* score_cache);
+
+    /**
+    Run every stage and write each row
+
+    @returns Result cache entries of the board files in input order
+    @warning Rethrows the error of the first board file in input order that failed, after stopping every stage
+    */
+    std::vector<std::pair<std::string, ResultCacheEntry>> run(ResultWriter& result_writer);
+
+    size_t get_num_unchanged() const noexcept
+    {
+        return num_unchanged.load();
+    }
+
+    /// @returns Number of board paths taken from the source
+    size_t get_num_board_files() const noexcept
+    {
+        return num_board_files;
+    }
+
+private:
+    /// Size of a pool buffer, board files are far smaller and longer files are read separately
+    static constexpr size_t file_buffer_size = 1024;
+
+    /// Start the threads of a stage, the last one to finish closes the queue it feeds
+    template <typename Function>
+    void start_stage(std::vector<std::thread>& threads, unsigned num_stage_threads, BoundedQueue<BoardFileItem>& output_queue, Function function);
+
+    /**
+    Take the board paths from the source, numbering them in input order
+
+    Waits while the next index is a window ahead of the next row to write. An error of the source
+    becomes the error of the last item, after which the source is not called again.
+    */
+    void produce();
+
+    /// Claim batches of files in input order and load the ones that are not cached
+    void read();
+
+    /**
+    Take the next numbered paths, waiting for the first one
+
+    @returns Whether any item is claimed
+    */
+    bool claim_batch(std::vector<BoardFileItem>& items);
+
+    /// Keep the content of a loaded file in its item, or its error
+    void take_loaded_file(BoardFileItem& item, const LoadedFile& loaded_file);
+
+    void parse();
+
+    void score();
+
+    /// Write the rows in input order, keeping the items that finish early
+    void write(ResultWriter& result_writer, std::vector<std::pair<std::string, ResultCacheEntry>>& entries);
+
+    /// Let the readers claim files up to a window ahead of given row
+    void advance_window(size_t next_row);
+
+    std::function<std::optional<std::filesystem::path>()> next_board_path;
+    ResultCache* result_cache;
+    PipelineOptions options;
+    ScoreCache* score_cache;
+    unsigned num_read_threads;
+    unsigned num_parse_threads;
+    unsigned num_score_threads;
+    /// Number of items claimed but not written at most
+    size_t window_size;
+
+    BoundedQueue<BoardFileItem> path_queue;
+    BoundedQueue<BoardFileItem> read_queue;
+    BoundedQueue<BoardFileItem> parse_queue;
+    BoundedQueue<BoardFileItem> score_queue;
+    FileBufferPool buffer_pool;
+
+    /// Only written by the producer
+    size_t num_board_files = 0;
+
+    /// Guards the state below
+    std::mutex window_mutex;
+    /// Notified when the window advances or the pipeline is cancelled
+    std::condition_variable window_advanced;
+    /// Index of the next row to write, as last published by the writer
+    size_t window_begin = 0;
+
+    std::atomic<bool> is_cancelled = false;
+    std::atomic<size_t> num_unchanged = 0;
+};
+
+} // namespace chess
+
+#endif // CHESS_SCORE_CALCULATOR_BOARD_FILE_PIPELINE_HPP
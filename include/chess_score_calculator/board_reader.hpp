@@ -0,0 +1,55 @@
+#ifndef CHESS_SCORE_CALCULATOR_BOARD_READER_HPP
+#define CHESS_SCORE_CALCULATOR_BOARD_READER_HPP
+
+////////////////////////////////////////////////////////////////////////////////
+// Standard Libraries
+#include <cstddef>
+#include <istream>
+#include <optional>
+#include <string>
+////////////////////////////////////////////////////////////////////////////////
+// User Defined Libraries
+#include <chess_score_calculator/chessboard.hpp>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace chess {
+
+/// A board read from a container
+struct BoardRecord {
+    std::string id;
+    Chessboard chessboard;
+};
+
+/**
+Reads boards one at a time from a container of many boards
+
+Each board consists of 8 rows in the same format as a single board file.
+A line starting with `#` sets the ID of the following board, otherwise the ID is `<name>:<n>` for the n-th board.
+Empty lines are ignored. Only the board being read is kept in memory.
+*/
+class BoardStreamReader {
+public:
+    /// @param name Name of the container to be used in default IDs and errors
+    BoardStreamReader(std::istream& input, std::string name);
+
+    /**
+    Read the next board
+
+    @returns Empty if the end of the container is reached
+    @warning Throws if a board is invalid or incomplete
+    */
+    std::optional<BoardRecord> next();
+
+private:
+    std::istream& input;
+    std::string name;
+    size_t num_boards = 0;
+    size_t line_number = 0;
+    /// Buffers reused for every board
+    std::string line;
+    std::string board_denotation;
+};
+
+} // namespace chess
+
+#endif // CHESS_SCORE_CALCULATOR_BOARD_READER_HPP
@@ -0,0 +1,184 @@
+#ifndef CHESS_SCORE_CALCULATOR_BOUNDED_QUEUE_HPP
+#define CHESS_SCORE_CALCULATOR_BOUNDED_QUEUE_HPP
+
+////////////////////////////////////////////////////////////////////////////////
+// Standard Libraries
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace chess {
+
+/**
+Bounded multi-producer multi-consumer queue without locks
+
+Each cell has a sequence number that tells whether it is ready to be written or read at a position,
+so producers and consumers only contend on their own position counter (Dmitry Vyukov's design).
+The blocking operations wait on atomic counters, so an idle stage sleeps instead of spinning.
+*/
+template <typename T>
+class BoundedQueue {
+public:
+    /// @param capacity Rounded up to a power of two
+    explicit BoundedQueue(size_t capacity);
+
+    BoundedQueue(const BoundedQueue&) = delete;
+    BoundedQueue& operator=(const BoundedQueue&) = delete;
+
+    /// @returns Whether the value is moved into the queue, false if the queue is full
+    bool try_push(T& value);
+
+    /// @returns Front value, empty if the queue is empty
+    std::optional<T> try_pop();
+
+    /// Push a value, waiting while the queue is full
+    void push(T value);
+
+    /// @returns Front value, waiting while the queue is empty, or empty if the queue is closed and drained
+    std::optional<T> pop();
+
+    /// Let the consumers finish once the queue is drained, no value may be pushed afterwards
+    void close() noexcept;
+
+private:
+    struct alignas(64) Cell {
+        std::atomic<size_t> sequence;
+        T value;
+    };
+
+    std::unique_ptr<Cell[]> cells;
+    size_t mask;
+    alignas(64) std::atomic<size_t> enqueue_position = 0;
+    alignas(64) std::atomic<size_t> dequeue_position = 0;
+    /// Changed after each push and pop, waited on while the queue is empty or full
+    alignas(64) std::atomic<std::uint32_t> push_event = 0;
+    alignas(64) std::atomic<std::uint32_t> pop_event = 0;
+    std::atomic<bool> is_closed = false;
+};
+
+} // namespace chess
+
+////////////////////////////////////////////////////////////////////////////////
+// INLINE DEFINITIONS
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Standard Libraries
+#include <algorithm>
+#include <bit>
+#include <utility>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace chess {
+
+template <typename T>
+BoundedQueue<T>::BoundedQueue(size_t capacity)
+    : cells(new Cell[std::bit_ceil(std::max<size_t>(capacity, 2))])
+    , mask(std::bit_ceil(std::max<size_t>(capacity, 2)) - 1)
+{
+    for (size_t i = 0; i <= mask; i++) {
+        cells[i].sequence.store(i, std::memory_order_relaxed);
+    }
+}
+
+template <typename T>
+bool BoundedQueue<T>::try_push(T& value)
+{
+    size_t position = enqueue_position.load(std::memory_order_relaxed);
+    while (true) {
+        Cell& cell = cells[position & mask];
+        const size_t sequence = cell.sequence.load(std::memory_order_acquire);
+        const auto difference = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(position);
+        if (difference == 0) {
+            // the cell is free at this position, claim the position
+            if (enqueue_position.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                cell.value = std::move(value);
+                cell.sequence.store(position + 1, std::memory_order_release);
+                return true;
+            }
+        } else if (difference < 0) {
+            // the cell still holds the value of the previous lap
+            return false;
+        } else {
+            position = enqueue_position.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+template <typename T>
+std::optional<T> BoundedQueue<T>::try_pop()
+{
+    size_t position = dequeue_position.load(std::memory_order_relaxed);
+    while (true) {
+        Cell& cell = cells[position & mask];
+        const size_t sequence = cell.sequence.load(std::memory_order_acquire);
+        const auto difference = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(position + 1);
+        if (difference == 0) {
+            // the cell is written at this position, claim the position
+            if (dequeue_position.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                std::optional<T> result(std::move(cell.value));
+                cell.sequence.store(position + mask + 1, std::memory_order_release);
+                return result;
+            }
+        } else if (difference < 0) {
+            // the cell is not written yet
+            return std::nullopt;
+        } else {
+            position = dequeue_position.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+template <typename T>
+void BoundedQueue<T>::push(T value)
+{
+    while (!try_push(value)) {
+        // a pop after reading the event changes it, so the wait cannot miss the free cell
+        const std::uint32_t event = pop_event.load(std::memory_order_acquire);
+        if (try_push(value)) {
+            break;
+        }
+        pop_event.wait(event, std::memory_order_acquire);
+    }
+    push_event.fetch_add(1, std::memory_order_release);
+    push_event.notify_all();
+}
+
+template <typename T>
+std::optional<T> BoundedQueue<T>::pop()
+{
+    while (true) {
+        std::optional<T> result = try_pop();
+        if (!result) {
+            // a push or close after reading the event changes it, so the wait cannot miss them
+            const std::uint32_t event = push_event.load(std::memory_order_acquire);
+            result = try_pop();
+            if (!result) {
+                if (is_closed.load(std::memory_order_acquire)) {
+                    // every push happened before closing
+                    return try_pop();
+                }
+                push_event.wait(event, std::memory_order_acquire);
+                continue;
+            }
+        }
+        pop_event.fetch_add(1, std::memory_order_release);
+        pop_event.notify_all();
+        return result;
+    }
+}
+
+template <typename T>
+void BoundedQueue<T>::close() noexcept
+{
+    is_closed.store(true, std::memory_order_release);
+    push_event.fetch_add(1, std::memory_order_release);
+    push_event.notify_all();
+}
+
+} // namespace chess
+
+#endif // CHESS_SCORE_CALCULATOR_BOUNDED_QUEUE_HPP
@@ -4,48 +4,230 @@
 ////////////////////////////////////////////////////////////////////////////////
 // Standard Libraries
 #include <array>
+#include <cstdint>
 #include <filesystem>
-#include <set>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <type_traits>
+#include <vector>
 ////////////////////////////////////////////////////////////////////////////////
 // User Defined Libraries
+#include <chess_score_calculator/bitboard.hpp>
+#include <chess_score_calculator/coordinate_set.hpp>
 #include <chess_score_calculator/enums.hpp>
+#include <chess_score_calculator/packed_board.hpp>
 #include <chess_score_calculator/tile.hpp>
 ////////////////////////////////////////////////////////////////////////////////
 
 namespace chess {
 
+/// Scores of both sides at the same board
+struct Score {
+    double white;
+    double black;
+};
+
+/// A move of a piece, see Chessboard::make_move
+struct Move {
+    Coordinate from;
+    Coordinate to;
+    /// Piece type a pawn becomes at the last row
+    std::optional<PieceType> promotion;
+    /// Whether a pawn captures the pawn that passed its target tile, which is behind the target tile
+    bool is_en_passant = false;
+    /// Whether a king moves two tiles towards a rook, which moves next to the king on the other side
+    bool is_castling = false;
+
+    friend constexpr bool operator==(const Move& lhs, const Move& rhs) = default;
+};
+
 class Chessboard {
 public:
     /// @warning Throws if file is invalid
     explicit Chessboard(const std::filesystem::path& board_file);
 
-    /// @warning Throws if coordinate is out of bounds
-    Tile& get_tile_at(const Coordinate& coordinate) &;
+    /**
+    Parse the board denotation in place, i.e. without copying or allocating
 
-    /// @overload
-    const Tile& get_tile_at(const Coordinate& coordinate) const&;
+    @param board_denotation 64 whitespace separated tiles starting from a8, same as the file content
+    @warning Throws if denotation is invalid
+    */
+    static Chessboard from_string(std::string_view board_denotation);
+
+    /**
+    Parse the content of a board file that is read separately
+
+    @param board_file Source of the content to report in errors
+    @warning Throws if denotation is invalid
+    */
+    static Chessboard from_string(std::string_view board_denotation, const std::filesystem::path& board_file);
 
-    /// Avoid dangling reference
     /// @overload
-    Tile get_tile_at(const Coordinate& coordinate) && = delete;
+    static Chessboard from_buffer(std::span<const char> board_denotation);
+
+    /**
+    Parse the piece placement field of a FEN record without allocating
+
+    @param fen FEN record, only the characters before the first whitespace are read
+    @warning Throws if piece placement is invalid
+    */
+    static Chessboard from_fen(std::string_view fen);
+
+    /**
+    Decode a packed board, which requires no parsing
+
+    @warning Throws if a tile has an invalid encoding
+    */
+    static Chessboard from_packed(const PackedBoard& packed_board);
 
-    std::set<Coordinate> get_white_piece_coordinates() const;
-    std::set<Coordinate> get_black_piece_coordinates() const;
-    std::set<Coordinate> get_all_piece_coordinates() const;
+    /**
+    Create a tile from the occupancy bitboards
 
-    std::set<Coordinate> get_threatened_white_piece_coordinates() const;
-    std::set<Coordinate> get_threatened_black_piece_coordinates() const;
+    @warning Throws if coordinate is out of bounds
+    */
+    Tile get_tile_at(const Coordinate& coordinate) const;
 
-    std::set<Coordinate> get_unthreatened_white_piece_coordinates() const;
-    std::set<Coordinate> get_unthreatened_black_piece_coordinates() const;
+    /// @returns Type of the piece at given coordinate, if any
+    std::optional<PieceType> get_piece_type_at(const Coordinate& coordinate) const noexcept;
+
+    /// @returns Tiles occupied by pieces of given side
+    Bitboard get_bitboard(Side side) const noexcept;
+
+    /// @returns Tiles occupied by pieces of given type, regardless of their side
+    Bitboard get_bitboard(PieceType piece_type) const noexcept;
+
+    /// @returns Tiles occupied by any piece
+    Bitboard get_bitboard() const noexcept;
+
+    /// @returns Tiles of given side that are threatened by the opposite side
+    Bitboard get_threatened_bitboard(Side side) const;
+
+    /**
+    @returns Zobrist hash of the piece placement, see #get_zobrist_key
+
+    It is computed while parsing and updated by each move, the side to move is not included.
+    */
+    std::uint64_t get_hash() const noexcept;
+
+    CoordinateSet get_white_piece_coordinates() const;
+    CoordinateSet get_black_piece_coordinates() const;
+    CoordinateSet get_all_piece_coordinates() const;
+
+    CoordinateSet get_threatened_white_piece_coordinates() const;
+    CoordinateSet get_threatened_black_piece_coordinates() const;
+
+    CoordinateSet get_unthreatened_white_piece_coordinates() const;
+    CoordinateSet get_unthreatened_black_piece_coordinates() const;
 
     double score_of_whites() const;
     double score_of_blacks() const;
 
+    /// Calculate the scores of both sides by generating each threat map once
+    Score score() const;
+
+    /**
+    Move a piece, capturing the opponent piece at the target tile if any
+
+    Movement rules are not checked. After the first move, the attacks of each piece are cached
+    and only the moved and captured pieces and the sliders that see either tile are regenerated.
+    @warning Throws if source tile is empty or target tile has a piece of the same side
+    */
+    void make_move(const Coordinate& from, const Coordinate& to);
+
+    /**
+    Make a move including its promotion, en passant capture or castling rook move
+
+    Movement rules are not checked other than the tiles the special moves require.
+    @warning Throws if a tile does not hold the piece the move requires
+    */
+    void make_move(const Move& move);
+
+    /**
+    Generate and cache the attacks of every piece, which #make_move otherwise does at the first move
+
+    Copies of the board keep the cache, so each copy only regenerates the pieces its move affects.
+    */
+    void build_attack_cache() noexcept;
+
+    /**
+    Revert the last move made by #make_move
+
+    @warning Throws if there is no move to revert
+    */
+    void unmake_move();
+
 private:
-    std::array<std::array<Tile, 8>, 8> tiles;
+    /// Information to revert a move
+    struct MoveRecord {
+        int from;
+        int to;
+        PieceType piece_type;
+        std::optional<PieceType> captured_piece_type;
+        /// Tile of the captured piece, differs from the target tile for en passant
+        int captured_square;
+        std::optional<PieceType> promotion;
+        /// Tiles of the castling rook before and after the move, equal if not castling
+        int rook_from;
+        int rook_to;
+    };
+
+    /// Empty board
+    Chessboard() = default;
+
+    /**
+    Fill the board from its denotation
+
+    @param board_file Source of the denotation to report in errors, nullptr if parsed from memory
+    @warning Throws if denotation is invalid
+    */
+    void parse(std::string_view board_denotation, const std::filesystem::path* board_file);
+
+    /// @warning Throws if piece placement is invalid
+    void parse_fen(std::string_view piece_placement);
+
+    /// @param threatened Tiles of given side that are threatened by the opposite side
+    double score_of(Side side, Bitboard threatened) const noexcept;
+
+    /// Place a piece at an empty tile
+    void put_piece(const Coordinate& coordinate, PieceType piece_type, Side side) noexcept;
+
+    /// Remove the piece at an occupied tile
+    void remove_piece(int square, PieceType piece_type, Side side) noexcept;
+
+    /// @returns Tiles attacked by given piece at bit index with the current occupancy
+    Bitboard get_attacks_of(int square, PieceType piece_type, Side side) const noexcept;
+
+    /// @returns Sliders of both sides that attack any of the given tiles
+    Bitboard get_sliders_attacking(Bitboard targets) const noexcept;
+
+    /// Regenerate the attacks of given pieces and the union of attacks of each side
+    void update_attack_cache(Bitboard pieces) noexcept;
+
+    /// Occupancy indexed by #Side
+    std::array<Bitboard, 2> side_bitboards {};
+
+    /// Occupancy indexed by #PieceType
+    std::array<Bitboard, 6> piece_type_bitboards {};
+
+    /// XOR of the Zobrist keys of all pieces
+    std::uint64_t hash = 0;
+
+    /// Whether the caches below are up to date, they are built at the first move
+    bool has_attack_cache = false;
+
+    /// Attacks of the piece at each bit index, empty for empty tiles
+    std::array<Bitboard, 64> piece_attacks {};
+
+    /// Union of attacks of each side, indexed by #Side
+    std::array<Bitboard, 2> side_attacks {};
+
+    std::vector<MoveRecord> move_history;
 };
 
+// pieces are values, so boards can be copied and moved freely
+static_assert(std::is_copy_constructible_v<Chessboard> && std::is_nothrow_move_constructible_v<Chessboard>);
+
 } // namespace chess
 
 #endif // CHESS_SCORE_CALCULATOR_CHESSBOARD_HPP
@@ -0,0 +1,218 @@
+#ifndef CHESS_SCORE_CALCULATOR_COORDINATE_SET_HPP
+#define CHESS_SCORE_CALCULATOR_COORDINATE_SET_HPP
+
+////////////////////////////////////////////////////////////////////////////////
+// Standard Libraries
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <set>
+////////////////////////////////////////////////////////////////////////////////
+// User Defined Libraries
+#include <chess_score_calculator/bitboard.hpp>
+#include <chess_score_calculator/enums.hpp>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace chess {
+
+/**
+Set of coordinates backed by a bitboard
+
+It never allocates and iterates in ascending #Coordinate order, same as `std::set<Coordinate>`.
+*/
+class CoordinateSet {
+public:
+    /// Forward iterator that yields coordinates by value
+    class Iterator {
+    public:
+        using iterator_concept = std::forward_iterator_tag;
+        using iterator_category = std::input_iterator_tag;
+        using value_type = Coordinate;
+        using difference_type = std::ptrdiff_t;
+
+        /// Default constructor is the end iterator
+        constexpr Iterator() noexcept = default;
+
+        /// @param remaining Tiles that are not iterated yet
+        constexpr explicit Iterator(Bitboard remaining) noexcept;
+
+        constexpr Coordinate operator*() const noexcept;
+        constexpr Iterator& operator++() noexcept;
+        constexpr Iterator operator++(int) noexcept;
+
+        friend constexpr bool operator==(const Iterator& lhs, const Iterator& rhs) noexcept = default;
+
+    private:
+        Bitboard remaining = 0;
+    };
+
+    /// Empty set
+    constexpr CoordinateSet() noexcept = default;
+
+    constexpr explicit CoordinateSet(Bitboard bitboard) noexcept;
+
+    /// @warning Coordinates must be valid
+    constexpr CoordinateSet(std::initializer_list<Coordinate> coordinates) noexcept;
+
+    /// Keep compatibility with the former `std::set` based interface
+    operator std::set<Coordinate>() const;
+
+    constexpr Bitboard get_bitboard() const noexcept;
+
+    constexpr Iterator begin() const noexcept;
+    constexpr Iterator end() const noexcept;
+
+    constexpr bool empty() const noexcept;
+    constexpr size_t size() const noexcept;
+
+    /// @warning Coordinate must be valid
+    constexpr bool contains(const Coordinate& coordinate) const noexcept;
+
+    /// @warning Coordinate must be valid
+    constexpr void insert(const Coordinate& coordinate) noexcept;
+
+    /// @warning Coordinate must be valid
+    constexpr void erase(const Coordinate& coordinate) noexcept;
+
+    constexpr CoordinateSet& operator|=(const CoordinateSet& other) noexcept;
+    constexpr CoordinateSet& operator&=(const CoordinateSet& other) noexcept;
+    constexpr CoordinateSet& operator-=(const CoordinateSet& other) noexcept;
+
+    /// Union
+    friend constexpr CoordinateSet operator|(CoordinateSet lhs, const CoordinateSet& rhs) noexcept { return lhs |= rhs; }
+
+    /// Intersection
+    friend constexpr CoordinateSet operator&(CoordinateSet lhs, const CoordinateSet& rhs) noexcept { return lhs &= rhs; }
+
+    /// Difference
+    friend constexpr CoordinateSet operator-(CoordinateSet lhs, const CoordinateSet& rhs) noexcept { return lhs -= rhs; }
+
+    friend constexpr bool operator==(const CoordinateSet& lhs, const CoordinateSet& rhs) noexcept = default;
+
+private:
+    Bitboard bitboard = 0;
+};
+
+static_assert(std::forward_iterator<CoordinateSet::Iterator>);
+
+} // namespace chess
+
+////////////////////////////////////////////////////////////////////////////////
+// INLINE DEFINITIONS
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Standard Libraries
+#include <bit>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace chess {
+
+constexpr CoordinateSet::Iterator::Iterator(Bitboard remaining) noexcept
+    : remaining(remaining)
+{
+}
+
+constexpr Coordinate CoordinateSet::Iterator::operator*() const noexcept
+{
+    return to_coordinate(std::countr_zero(remaining));
+}
+
+constexpr CoordinateSet::Iterator& CoordinateSet::Iterator::operator++() noexcept
+{
+    remaining &= remaining - 1;
+    return *this;
+}
+
+constexpr CoordinateSet::Iterator CoordinateSet::Iterator::operator++(int) noexcept
+{
+    Iterator result = *this;
+    ++*this;
+    return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+constexpr CoordinateSet::CoordinateSet(Bitboard bitboard) noexcept
+    : bitboard(bitboard)
+{
+}
+
+constexpr CoordinateSet::CoordinateSet(std::initializer_list<Coordinate> coordinates) noexcept
+{
+    for (const Coordinate& coordinate : coordinates) {
+        insert(coordinate);
+    }
+}
+
+inline CoordinateSet::operator std::set<Coordinate>() const
+{
+    // coordinates are iterated at increasing order, so always insert at the end
+    std::set<Coordinate> result;
+    for (const Coordinate coordinate : *this) {
+        result.emplace_hint(result.end(), coordinate);
+    }
+    return result;
+}
+
+constexpr Bitboard CoordinateSet::get_bitboard() const noexcept
+{
+    return bitboard;
+}
+
+constexpr CoordinateSet::Iterator CoordinateSet::begin() const noexcept
+{
+    return Iterator(bitboard);
+}
+
+constexpr CoordinateSet::Iterator CoordinateSet::end() const noexcept
+{
+    return Iterator();
+}
+
+constexpr bool CoordinateSet::empty() const noexcept
+{
+    return bitboard == 0;
+}
+
+constexpr size_t CoordinateSet::size() const noexcept
+{
+    return static_cast<size_t>(std::popcount(bitboard));
+}
+
+constexpr bool CoordinateSet::contains(const Coordinate& coordinate) const noexcept
+{
+    return (bitboard & to_bitboard(coordinate)) != 0;
+}
+
+constexpr void CoordinateSet::insert(const Coordinate& coordinate) noexcept
+{
+    bitboard |= to_bitboard(coordinate);
+}
+
+constexpr void CoordinateSet::erase(const Coordinate& coordinate) noexcept
+{
+    bitboard &= ~to_bitboard(coordinate);
+}
+
+constexpr CoordinateSet& CoordinateSet::operator|=(const CoordinateSet& other) noexcept
+{
+    bitboard |= other.bitboard;
+    return *this;
+}
+
+constexpr CoordinateSet& CoordinateSet::operator&=(const CoordinateSet& other) noexcept
+{
+    bitboard &= other.bitboard;
+    return *this;
+}
+
+constexpr CoordinateSet& CoordinateSet::operator-=(const CoordinateSet& other) noexcept
+{
+    bitboard &= ~other.bitboard;
+    return *this;
+}
+
+} // namespace chess
+
+#endif // CHESS_SCORE_CALCULATOR_COORDINATE_SET_HPP
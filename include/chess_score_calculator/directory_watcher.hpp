@@ -0,0 +1,76 @@
+#ifndef CHESS_SCORE_CALCULATOR_DIRECTORY_WATCHER_HPP
+#define CHESS_SCORE_CALCULATOR_DIRECTORY_WATCHER_HPP
+
+////////////////////////////////////////////////////////////////////////////////
+// Standard Libraries
+#include <atomic>
+#include <filesystem>
+#include <unordered_map>
+#include <vector>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace chess {
+
+/// A file that is written or removed, or a removed directory
+struct FileChange {
+    std::filesystem::path file;
+    bool is_removed;
+    /// Whether every file under the directory is removed
+    bool is_directory = false;
+};
+
+/**
+@returns Regular files under a directory and its subdirectories, skipping the subdirectories removed meanwhile
+@warning Throws if directory is not found or cannot be iterated
+*/
+std::vector<std::filesystem::path> get_regular_files(const std::filesystem::path& directory);
+
+/**
+Reports the files written under a directory by inotify
+
+A file is reported when it is closed after writing or moved in, so partially written files are not reported.
+Subdirectories, including the ones created later, are watched too. Only available on Linux.
+*/
+class DirectoryWatcher {
+public:
+    /// @warning Throws if directory cannot be watched or the platform is not Linux
+    explicit DirectoryWatcher(std::filesystem::path directory);
+
+    ~DirectoryWatcher();
+
+    DirectoryWatcher(const DirectoryWatcher&) = delete;
+    DirectoryWatcher& operator=(const DirectoryWatcher&) = delete;
+
+    /**
+    Block until a file is changed or #stop is called
+
+    Every change that is already queued is returned at once, only the last change of a file is kept.
+    A removed or moved out subdirectory is reported as a removed directory. If the event queue overflows,
+    the watched directory itself is reported as removed, followed by every file under it as written.
+    @returns Empty if stopped
+    @warning Throws if reading events fails
+    */
+    std::vector<FileChange> wait_changes();
+
+    /// Make #wait_changes return, safe to call from another thread or a signal handler
+    void stop() noexcept;
+
+private:
+    /// Watch a directory and its subdirectories, skipping the ones removed meanwhile
+    void add_watches(const std::filesystem::path& directory);
+
+    /// Stop watching a directory and its subdirectories, e.g. when moved out
+    void remove_watches(const std::filesystem::path& directory);
+
+    std::filesystem::path directory;
+    int inotify_fd = -1;
+    /// Wakes #wait_changes for #stop
+    int event_fd = -1;
+    std::atomic<bool> is_stopped = false;
+    /// Watched directories by watch descriptor
+    std::unordered_map<int, std::filesystem::path> watched_directories;
+};
+
+} // namespace chess
+
+#endif // CHESS_SCORE_CALCULATOR_DIRECTORY_WATCHER_HPP
@@ -14,6 +14,18 @@ enum class Side {
     Black,
 };
 
+/// @returns The side that opposes given side
+constexpr Side get_opposite_side(Side side) noexcept;
+
+enum class PieceType {
+    Pawn,
+    Knight,
+    Bishop,
+    Rook,
+    Queen,
+    King,
+};
+
 /// y coordinate at increasing order
 enum class Row {
     _1,
@@ -70,6 +82,11 @@ std::optional<Coordinate> get_coordinate_at(const Coordinate& anchor, int row_up
 
 namespace chess {
 
+constexpr Side get_opposite_side(Side side) noexcept
+{
+    return (side == Side::White) ? Side::Black : Side::White;
+}
+
 constexpr bool is_valid_coordinate(const Coordinate& coordinate) noexcept
 {
     const int row = static_cast<int>(coordinate.row);
@@ -0,0 +1,54 @@
+#ifndef CHESS_SCORE_CALCULATOR_EPD_READER_HPP
+#define CHESS_SCORE_CALCULATOR_EPD_READER_HPP
+
+////////////////////////////////////////////////////////////////////////////////
+// Standard Libraries
+#include <cstddef>
+#include <optional>
+#include <string_view>
+////////////////////////////////////////////////////////////////////////////////
+// User Defined Libraries
+#include <chess_score_calculator/chessboard.hpp>
+#include <chess_score_calculator/enums.hpp>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace chess {
+
+/// A position read from an EPD line
+struct EpdRecord {
+    /// Operand of the `id` operation, empty if not given
+    std::string_view id;
+    /// Starting from 1
+    size_t line_number;
+    Chessboard chessboard;
+    Side side_to_move;
+};
+
+/**
+Reads positions line by line from EPD content without copying or allocating
+
+Each line holds a FEN piece placement, optionally followed by the side to move, castling, en passant fields and operations.
+Full FEN records are accepted as well. Empty lines and lines starting with `#` are ignored.
+*/
+class EpdReader {
+public:
+    /// @param epd Whole EPD content, must outlive the reader and its records
+    explicit EpdReader(std::string_view epd) noexcept;
+
+    /**
+    Read the next position
+
+    @returns Empty if the end of the content is reached
+    @warning Throws if a line is invalid
+    */
+    std::optional<EpdRecord> next();
+
+private:
+    std::string_view epd;
+    size_t position = 0;
+    size_t line_number = 0;
+};
+
+} // namespace chess
+
+#endif // CHESS_SCORE_CALCULATOR_EPD_READER_HPP
@@ -0,0 +1,50 @@
+#ifndef CHESS_SCORE_CALCULATOR_MAPPED_FILE_HPP
+#define CHESS_SCORE_CALCULATOR_MAPPED_FILE_HPP
+
+////////////////////////////////////////////////////////////////////////////////
+// Standard Libraries
+#include <cstddef>
+#include <filesystem>
+#include <span>
+#include <string>
+#include <string_view>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace chess {
+
+/**
+Read-only view of a whole file
+
+The file is memory mapped on POSIX systems and read into an owned buffer elsewhere.
+*/
+class MappedFile {
+public:
+    /// @warning Throws if file is not a readable regular file
+    explicit MappedFile(const std::filesystem::path& file);
+
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    std::span<const char> get_data() const noexcept;
+
+    /// @overload
+    std::string_view get_view() const noexcept;
+
+private:
+    /// Release the mapping, if any
+    void unmap() noexcept;
+
+    const char* data = nullptr;
+    size_t size = 0;
+    /// Only used when memory mapping is not available
+    std::string buffer;
+};
+
+} // namespace chess
+
+#endif // CHESS_SCORE_CALCULATOR_MAPPED_FILE_HPP
@@ -0,0 +1,41 @@
+#ifndef CHESS_SCORE_CALCULATOR_MOVE_EVALUATOR_HPP
+#define CHESS_SCORE_CALCULATOR_MOVE_EVALUATOR_HPP
+
+////////////////////////////////////////////////////////////////////////////////
+// Standard Libraries
+#include <cstddef>
+#include <vector>
+////////////////////////////////////////////////////////////////////////////////
+// User Defined Libraries
+#include <chess_score_calculator/chessboard.hpp>
+#include <chess_score_calculator/enums.hpp>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace chess {
+
+/// Scores of a board after a move
+struct MoveEvaluation {
+    Move move;
+    Score score;
+    /// Change of the score of the moving side minus the score of its opponent
+    double delta;
+};
+
+/**
+Make a move on a copy of the board and score the result
+
+The copy shares no state with the board, so moves of the same board can be evaluated concurrently.
+If the attacks of the board are cached, see Chessboard::build_attack_cache, only the pieces the move
+affects are regenerated.
+@param score Score of the board before the move
+@param side Side of the moving piece
+@warning Throws if the move is invalid
+*/
+MoveEvaluation evaluate_move(const Chessboard& chessboard, const Score& score, Side side, const Move& move);
+
+/// Sort by decreasing delta and keep the first num_moves evaluations, 0 keeps all
+void select_top_moves(std::vector<MoveEvaluation>& evaluations, size_t num_moves);
+
+} // namespace chess
+
+#endif // CHESS_SCORE_CALCULATOR_MOVE_EVALUATOR_HPP
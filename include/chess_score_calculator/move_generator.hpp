@@ -0,0 +1,31 @@
+#ifndef CHESS_SCORE_CALCULATOR_MOVE_GENERATOR_HPP
+#define CHESS_SCORE_CALCULATOR_MOVE_GENERATOR_HPP
+
+////////////////////////////////////////////////////////////////////////////////
+// Standard Libraries
+#include <string>
+#include <vector>
+////////////////////////////////////////////////////////////////////////////////
+// User Defined Libraries
+#include <chess_score_calculator/chessboard.hpp>
+#include <chess_score_calculator/enums.hpp>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace chess {
+
+/**
+Generate the pseudo-legal moves of a side, i.e. moves that may leave its own king threatened
+
+Pieces move to the tiles they threaten that are empty or hold an opponent piece, pawns also advance one
+tile, or two from their initial row, and promote to a knight, bishop, rook or queen at the last row.
+The opponent king is never captured, since its capture ends the game instead of leading to a position.
+Castling and en passant are not generated, since a board does not record the castling rights or the last move.
+*/
+std::vector<Move> generate_moves(const Chessboard& chessboard, Side side);
+
+/// @returns Move in long algebraic notation as used by UCI, e.g. `e2e4` or `e7e8q`
+std::string to_string(const Move& move);
+
+} // namespace chess
+
+#endif // CHESS_SCORE_CALCULATOR_MOVE_GENERATOR_HPP
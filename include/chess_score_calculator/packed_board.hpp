@@ -0,0 +1,57 @@
+#ifndef CHESS_SCORE_CALCULATOR_PACKED_BOARD_HPP
+#define CHESS_SCORE_CALCULATOR_PACKED_BOARD_HPP
+
+////////////////////////////////////////////////////////////////////////////////
+// Standard Libraries
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+////////////////////////////////////////////////////////////////////////////////
+// User Defined Libraries
+#include <chess_score_calculator/mapped_file.hpp>
+////////////////////////////////////////////////////////////////////////////////
+// Forward Declarations
+namespace chess {
+class Chessboard;
+}
+////////////////////////////////////////////////////////////////////////////////
+
+namespace chess {
+
+/**
+Fixed size binary encoding of a board
+
+Each tile is a nibble in bit index order, i.e. the low nibble of the first byte is a1.
+A nibble is 0 for an empty tile, otherwise its low 3 bits are #PieceType + 1 and its high bit is #Side.
+*/
+struct PackedBoard {
+    std::array<std::uint8_t, 32> nibbles;
+};
+
+/// Encode a board
+PackedBoard pack(const Chessboard& chessboard) noexcept;
+
+/**
+Read-only file of consecutive packed boards
+
+The file is memory mapped, so any record can be accessed without reading the preceding ones.
+*/
+class PackedBoardFile {
+public:
+    /// @warning Throws if file is not found or its size is not a multiple of the record size
+    explicit PackedBoardFile(const std::filesystem::path& file);
+
+    /// @returns Number of records
+    size_t size() const noexcept;
+
+    /// @warning Index must be less than #size
+    PackedBoard operator[](size_t index) const noexcept;
+
+private:
+    MappedFile mapped_file;
+};
+
+} // namespace chess
+
+#endif // CHESS_SCORE_CALCULATOR_PACKED_BOARD_HPP
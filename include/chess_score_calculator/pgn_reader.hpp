@@ -0,0 +1,115 @@
+#ifndef CHESS_SCORE_CALCULATOR_PGN_READER_HPP
+#define CHESS_SCORE_CALCULATOR_PGN_READER_HPP
+
+////////////////////////////////////////////////////////////////////////////////
+// Standard Libraries
+#include <cstddef>
+#include <optional>
+#include <string_view>
+#include <vector>
+////////////////////////////////////////////////////////////////////////////////
+// User Defined Libraries
+#include <chess_score_calculator/chessboard.hpp>
+#include <chess_score_calculator/enums.hpp>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace chess {
+
+/// A game read from PGN, its fields refer to the PGN content
+struct PgnGame {
+    /// Starting from 1
+    size_t game_number;
+    /// Value of the FEN tag, empty if the game starts from the initial position
+    std::string_view fen;
+    /// Moves in standard algebraic notation as written, e.g. `Nf3` or `exd8=Q+`
+    std::vector<std::string_view> moves;
+};
+
+/**
+Reads games one at a time from PGN content without copying it
+
+Tag pairs other than FEN are skipped, as are move numbers, comments, variations, numeric annotation glyphs and results.
+*/
+class PgnReader {
+public:
+    /// @param pgn Whole PGN content, must outlive the reader and its games
+    explicit PgnReader(std::string_view pgn) noexcept;
+
+    /**
+    Read the next game
+
+    @returns Empty if the end of the content is reached
+    @warning Throws if a tag, comment or variation is not closed
+    */
+    std::optional<PgnGame> next();
+
+private:
+    /// @returns Whether position is at the beginning of a line
+    bool is_at_line_start() const noexcept;
+
+    /// Move position to the beginning of the next line
+    void skip_line() noexcept;
+
+    std::string_view pgn;
+    size_t position = 0;
+    size_t game_number = 0;
+};
+
+/**
+Find the move given in standard algebraic notation, e.g. `Nbd7`, `exd6`, `O-O` or `e8=Q+`
+
+Among the pieces that can reach the target tile, a pinned piece is ruled out by making the move on
+the board and reverting it, so the board is unchanged when this returns.
+@param side Side to move
+@warning Throws if san is invalid, or no or more than one move of the side matches it
+*/
+Move to_move(Chessboard& chessboard, Side side, std::string_view san);
+
+/**
+Replays a game from its initial position move by move
+
+The board is updated by each move instead of being rebuilt, so the threat maps are only regenerated
+for the pieces a move affects.
+*/
+class GameReplay {
+public:
+    /**
+    @param game Must outlive the replay
+    @warning Throws if the FEN tag is invalid
+    */
+    explicit GameReplay(const PgnGame& game);
+
+    /**
+    Play the next move of the game
+
+    @returns Whether a move is played, false after the last move
+    @warning Throws if the move is invalid
+    */
+    bool play_next_move();
+
+    const Chessboard& get_chessboard() const noexcept
+    {
+        return chessboard;
+    }
+
+    Side get_side_to_move() const noexcept
+    {
+        return side_to_move;
+    }
+
+    /// @returns Number of moves played
+    size_t get_num_plies() const noexcept
+    {
+        return num_plies;
+    }
+
+private:
+    const PgnGame& game;
+    Chessboard chessboard;
+    Side side_to_move = Side::White;
+    size_t num_plies = 0;
+};
+
+} // namespace chess
+
+#endif // CHESS_SCORE_CALCULATOR_PGN_READER_HPP
@@ -3,11 +3,15 @@
 
 ////////////////////////////////////////////////////////////////////////////////
 // Standard Libraries
-#include <optional>
-#include <set>
+#include <array>
+#include <type_traits>
 ////////////////////////////////////////////////////////////////////////////////
 // User Defined Libraries
+#include <chess_score_calculator/attack_tables.hpp>
+#include <chess_score_calculator/bitboard.hpp>
+#include <chess_score_calculator/coordinate_set.hpp>
 #include <chess_score_calculator/enums.hpp>
+#include <chess_score_calculator/sliding_attacks.hpp>
 ////////////////////////////////////////////////////////////////////////////////
 // Forward Declarations
 namespace chess {
@@ -17,106 +21,135 @@ class Chessboard;
 
 namespace chess {
 
-/// Base class of all chess pieces
-class Piece {
-public:
-    /// Each piece has a coordinate at the board and belongs to an opposing side
-    Piece(Coordinate coordinate, Side side, const Chessboard& chessboard) noexcept;
-
-    virtual ~Piece() = default;
-
-    Coordinate get_coordinate() const noexcept;
-    Side get_side() const noexcept;
-
-    virtual constexpr double get_unthreatened_score() const noexcept = 0;
-
-    /// Get a list of threated pieces by this instance
-    virtual std::set<Coordinate> get_threated_piece_coordinates() const = 0;
+/**
+Properties of a piece type, resolved at compile time
 
-protected:
-    /// @returns True if target coordinate has opponent piece
-    bool coordinate_has_threated_piece(const Coordinate& target_coordinate) const;
+Each specialization has the score of an unthreatened piece and a static `get_attacks(square, side, occupancy)`.
+*/
+template <PieceType piece_type>
+struct PieceTraits;
 
-    /**
-    @param row_up Row number to increase. A negative value means going below.
-    @param col_right Column number to increase. A negative value means going left.
-    @see get_coordinate_at
-    @returns Non-empty coordinate if any piece is found at given direction
-    */
-    std::optional<Coordinate> find_piece_at_direction(int row_up, int col_right) const;
-
-    const Chessboard& chessboard;
+template <>
+struct PieceTraits<PieceType::Pawn> {
+    static constexpr double score = 1;
+    static constexpr Bitboard get_attacks(int square, Side side, Bitboard) noexcept { return get_pawn_attacks(side, square); }
+};
 
-private:
-    Coordinate coordinate;
-    Side side;
+template <>
+struct PieceTraits<PieceType::Knight> {
+    static constexpr double score = 3;
+    static constexpr Bitboard get_attacks(int square, Side, Bitboard) noexcept { return get_knight_attacks(square); }
 };
 
-////////////////////////////////////////////////////////////////////////////////
+template <>
+struct PieceTraits<PieceType::Bishop> {
+    static constexpr double score = 3;
+    static Bitboard get_attacks(int square, Side, Bitboard occupancy) noexcept { return get_bishop_attacks(square, occupancy); }
+};
 
-class Pawn : public Piece {
-public:
-    Pawn(Coordinate coordinate, Side side, const Chessboard& chessboard) noexcept;
+template <>
+struct PieceTraits<PieceType::Rook> {
+    static constexpr double score = 5;
+    static Bitboard get_attacks(int square, Side, Bitboard occupancy) noexcept { return get_rook_attacks(square, occupancy); }
+};
 
-    constexpr double get_unthreatened_score() const noexcept override { return 1; }
+template <>
+struct PieceTraits<PieceType::Queen> {
+    static constexpr double score = 9;
+    static Bitboard get_attacks(int square, Side, Bitboard occupancy) noexcept { return get_queen_attacks(square, occupancy); }
+};
 
-    std::set<Coordinate> get_threated_piece_coordinates() const override;
+template <>
+struct PieceTraits<PieceType::King> {
+    static constexpr double score = 100;
+    static constexpr Bitboard get_attacks(int square, Side, Bitboard) noexcept { return get_king_attacks(square); }
 };
 
-////////////////////////////////////////////////////////////////////////////////
+/// @returns Score of an unthreatened piece of given type
+constexpr double get_piece_score(PieceType piece_type) noexcept;
 
-class Knight : public Piece {
+/**
+@returns Tiles attacked by a piece of given type and side at bit index
+@param occupancy Tiles occupied by any piece, sliders stop at the first one
+*/
+Bitboard get_piece_attacks(PieceType piece_type, int square, Side side, Bitboard occupancy) noexcept;
+
+/// Chess piece as a plain value, it has no reference to a board
+class Piece {
 public:
-    Knight(Coordinate coordinate, Side side, const Chessboard& chessboard) noexcept;
+    /// Each piece has a type, a coordinate at the board and belongs to an opposing side
+    constexpr Piece(PieceType piece_type, Coordinate coordinate, Side side) noexcept;
 
-    constexpr double get_unthreatened_score() const noexcept override { return 3; }
+    constexpr PieceType get_type() const noexcept;
+    constexpr Coordinate get_coordinate() const noexcept;
+    constexpr Side get_side() const noexcept;
 
-    std::set<Coordinate> get_threated_piece_coordinates() const override;
-};
+    constexpr double get_unthreatened_score() const noexcept;
 
-////////////////////////////////////////////////////////////////////////////////
+    /// Get a list of threated pieces by this instance at given board
+    CoordinateSet get_threated_piece_coordinates(const Chessboard& chessboard) const;
 
-class Bishop : public Piece {
-public:
-    Bishop(Coordinate coordinate, Side side, const Chessboard& chessboard) noexcept;
+private:
+    PieceType piece_type;
+    Coordinate coordinate;
+    Side side;
+};
 
-    constexpr double get_unthreatened_score() const noexcept override { return 3; }
+static_assert(std::is_trivially_copyable_v<Piece>);
 
-    std::set<Coordinate> get_threated_piece_coordinates() const override;
-};
+} // namespace chess
 
+////////////////////////////////////////////////////////////////////////////////
+// INLINE DEFINITIONS
 ////////////////////////////////////////////////////////////////////////////////
 
-class Rook : public Piece {
-public:
-    Rook(Coordinate coordinate, Side side, const Chessboard& chessboard) noexcept;
+namespace chess {
 
-    constexpr double get_unthreatened_score() const noexcept override { return 5; }
+namespace piece_traits {
 
-    std::set<Coordinate> get_threated_piece_coordinates() const override;
+/// Scores indexed by #PieceType
+inline constexpr std::array<double, 6> scores {
+    PieceTraits<PieceType::Pawn>::score,
+    PieceTraits<PieceType::Knight>::score,
+    PieceTraits<PieceType::Bishop>::score,
+    PieceTraits<PieceType::Rook>::score,
+    PieceTraits<PieceType::Queen>::score,
+    PieceTraits<PieceType::King>::score,
 };
 
-////////////////////////////////////////////////////////////////////////////////
-
-class Queen : public Piece {
-public:
-    Queen(Coordinate coordinate, Side side, const Chessboard& chessboard) noexcept;
+} // namespace piece_traits
 
-    constexpr double get_unthreatened_score() const noexcept override { return 9; }
+constexpr double get_piece_score(PieceType piece_type) noexcept
+{
+    return piece_traits::scores[static_cast<size_t>(piece_type)];
+}
 
-    std::set<Coordinate> get_threated_piece_coordinates() const override;
-};
+constexpr Piece::Piece(PieceType piece_type, Coordinate coordinate, Side side) noexcept
+    : piece_type(piece_type)
+    , coordinate(coordinate)
+    , side(side)
+{
+}
 
-////////////////////////////////////////////////////////////////////////////////
+constexpr PieceType Piece::get_type() const noexcept
+{
+    return piece_type;
+}
 
-class King : public Piece {
-public:
-    King(Coordinate coordinate, Side side, const Chessboard& chessboard) noexcept;
+constexpr Coordinate Piece::get_coordinate() const noexcept
+{
+    return coordinate;
+}
 
-    constexpr double get_unthreatened_score() const noexcept override { return 100; }
+constexpr Side Piece::get_side() const noexcept
+{
+    return side;
+}
 
-    std::set<Coordinate> get_threated_piece_coordinates() const override;
-};
+constexpr double Piece::get_unthreatened_score() const noexcept
+{
+    return get_piece_score(piece_type);
+}
 
 } // namespace chess
 
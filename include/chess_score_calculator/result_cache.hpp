@@ -0,0 +1,80 @@
+#ifndef CHESS_SCORE_CALCULATOR_RESULT_CACHE_HPP
+#define CHESS_SCORE_CALCULATOR_RESULT_CACHE_HPP
+
+////////////////////////////////////////////////////////////////////////////////
+// Standard Libraries
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <unordered_map>
+////////////////////////////////////////////////////////////////////////////////
+// User Defined Libraries
+#include <chess_score_calculator/chessboard.hpp>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace chess {
+
+/// Size and modification time of a file, a cheap check of whether it has changed
+struct FileStamp {
+    std::uintmax_t file_size;
+    std::int64_t modification_time;
+
+    friend bool operator==(const FileStamp& lhs, const FileStamp& rhs) noexcept = default;
+};
+
+/// @returns Stamp of a regular file, empty if it cannot be queried
+std::optional<FileStamp> get_file_stamp(const std::filesystem::path& file) noexcept;
+
+/// Score of a board file as of its stamp
+struct ResultCacheEntry {
+    FileStamp file_stamp;
+    /// #Chessboard::get_hash of the board, compared when the stamp has changed
+    std::uint64_t hash;
+    Score score;
+};
+
+/**
+Scores of board files persisted between runs
+
+The cache file is a text file with a line per board file, whose path is escaped to fit in the line.
+Saving keeps the loaded entries that are not inserted again while their board files exist, so runs
+over different directories can share a cache file.
+*/
+class ResultCache {
+public:
+    /// Load the cache file, a missing or invalid file is an empty cache, which save replaces
+    explicit ResultCache(std::filesystem::path cache_file);
+
+    /// @returns Key of a board file, i.e. its normalized absolute path
+    static std::string get_key(const std::filesystem::path& board_file);
+
+    /// @returns Entry of given key loaded from the cache file, if any
+    std::optional<ResultCacheEntry> find(const std::string& key) const;
+
+    /// Keep an entry to be saved
+    void insert(std::string key, const ResultCacheEntry& entry);
+
+    /**
+    Write the inserted entries and the loaded entries of existing files to the cache file, replacing it at once
+
+    @warning Throws if the cache file cannot be written
+    */
+    void save() const;
+
+private:
+    /**
+    Read the entries of the cache file
+
+    @warning Throws if the cache file is invalid
+    */
+    void load();
+
+    std::filesystem::path cache_file;
+    std::unordered_map<std::string, ResultCacheEntry> loaded_entries;
+    std::unordered_map<std::string, ResultCacheEntry> inserted_entries;
+};
+
+} // namespace chess
+
+#endif // CHESS_SCORE_CALCULATOR_RESULT_CACHE_HPP
@@ -0,0 +1,100 @@
+#ifndef CHESS_SCORE_CALCULATOR_RESULT_WRITER_HPP
+#define CHESS_SCORE_CALCULATOR_RESULT_WRITER_HPP
+
+////////////////////////////////////////////////////////////////////////////////
+// Standard Libraries
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <string>
+#include <string_view>
+////////////////////////////////////////////////////////////////////////////////
+// User Defined Libraries
+#include <chess_score_calculator/chessboard.hpp>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace chess {
+
+/// Header of the first table column, so the column is at least this wide
+constexpr std::string_view filename_header = "Chessboard filename";
+
+enum class OutputFormat {
+    /// Fixed width table with a header
+    Table,
+    /// Comma separated values with a header
+    Csv,
+    /// A JSON object per line
+    JsonLines,
+};
+
+std::string_view to_string(OutputFormat output_format) noexcept;
+
+/// @warning Throws if name is not `table`, `csv` or `jsonl`
+OutputFormat to_output_format(std::string_view name);
+
+/**
+Writes result rows as they are produced
+
+Rows are formatted into a large buffer that is written at once when it is full, so the output is
+streamed with few writes and without keeping the rows.
+*/
+class ResultWriter {
+public:
+    /**
+    Create the output file and write the header
+
+    @param filename_column_width Width of the first table column, at least the header width, longer names widen their row
+    @param output_file `-` means stdout only
+    @param is_echoed Whether the output is also written to stdout
+    @param has_delta_column Whether rows have a score change after the scores, see the overload of #write_row
+    @warning Throws if the output file cannot be created
+    */
+    ResultWriter(OutputFormat output_format, size_t filename_column_width, const std::filesystem::path& output_file, bool is_echoed, bool has_delta_column = false);
+
+    /// Write the buffered rows if not closed, errors are only reported by #close
+    ~ResultWriter();
+
+    ResultWriter(const ResultWriter&) = delete;
+    ResultWriter& operator=(const ResultWriter&) = delete;
+
+    /// @warning Throws if the buffer is full and cannot be written
+    void write_row(std::string_view filename, const Score& score);
+
+    /**
+    Write a row with a score change, the writer must be created with a delta column
+
+    @warning Throws if the buffer is full and cannot be written
+    */
+    void write_row(std::string_view filename, const Score& score, double delta);
+
+    /**
+    Write the buffered rows without waiting for the buffer to fill
+
+    @warning Throws if the output file cannot be written, e.g. if the disk is full
+    */
+    void flush();
+
+    /**
+    Write the buffered rows and close the output file, no row may be written afterwards
+
+    @warning Throws if the output file cannot be written or closed
+    */
+    void close();
+
+private:
+    static constexpr size_t buffer_size = 1 << 20;
+
+    void append_row(std::string_view filename, const Score& score, std::optional<double> delta);
+
+    OutputFormat output_format;
+    size_t filename_column_width;
+    std::filesystem::path output_file;
+    std::ofstream ofs;
+    bool is_written_to_stdout;
+    bool is_closed = false;
+    std::string buffer;
+};
+
+} // namespace chess
+
+#endif // CHESS_SCORE_CALCULATOR_RESULT_WRITER_HPP
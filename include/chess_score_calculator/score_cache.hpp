@@ -0,0 +1,62 @@
+#ifndef CHESS_SCORE_CALCULATOR_SCORE_CACHE_HPP
+#define CHESS_SCORE_CALCULATOR_SCORE_CACHE_HPP
+
+////////////////////////////////////////////////////////////////////////////////
+// Standard Libraries
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+////////////////////////////////////////////////////////////////////////////////
+// User Defined Libraries
+#include <chess_score_calculator/chessboard.hpp>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace chess {
+
+/**
+Bounded lock-free cache of scores keyed by #Chessboard::get_hash
+
+Each entry is two atomic words, the score and the hash XOR the score. An entry is only accepted if
+both words match the looked up hash, so a torn write of racing threads reads as a miss instead of
+a wrong score. A newer position replaces the older one at the same index.
+*/
+class ScoreCache {
+public:
+    /// @param num_entries Rounded up to a power of two, 16 bytes each
+    explicit ScoreCache(size_t num_entries);
+
+    ScoreCache(const ScoreCache&) = delete;
+    ScoreCache& operator=(const ScoreCache&) = delete;
+
+    /// @returns Score of the position, if cached. Counts as a hit or a miss.
+    std::optional<Score> find(std::uint64_t hash) noexcept;
+
+    void insert(std::uint64_t hash, const Score& score) noexcept;
+
+    /// @returns Cached score of the board, or its calculated score which is then cached
+    Score score(const Chessboard& chessboard);
+
+    size_t get_num_entries() const noexcept;
+    std::uint64_t get_num_hits() const noexcept;
+    std::uint64_t get_num_misses() const noexcept;
+
+private:
+    struct Entry {
+        std::atomic<std::uint64_t> checked_hash { 0 };
+        /// Half points of white at the high word and black at the low word, 0 if empty
+        std::atomic<std::uint64_t> data { 0 };
+    };
+
+    std::unique_ptr<Entry[]> entries;
+    size_t index_mask;
+
+    /// Counters are at their own cache lines, as every lookup of every thread updates one of them
+    alignas(64) std::atomic<std::uint64_t> num_hits { 0 };
+    alignas(64) std::atomic<std::uint64_t> num_misses { 0 };
+};
+
+} // namespace chess
+
+#endif // CHESS_SCORE_CALCULATOR_SCORE_CACHE_HPP
@@ -0,0 +1,131 @@
+#ifndef CHESS_SCORE_CALCULATOR_SCORE_SERVER_HPP
+#define CHESS_SCORE_CALCULATOR_SCORE_SERVER_HPP
+
+////////////////////////////////////////////////////////////////////////////////
+// Standard Libraries
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+////////////////////////////////////////////////////////////////////////////////
+// User Defined Libraries
+#include <chess_score_calculator/chessboard.hpp>
+#include <chess_score_calculator/score_cache.hpp>
+#include <chess_score_calculator/thread_pool.hpp>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace chess {
+
+/// @returns Board of a request, which is either a board denotation or a FEN record
+/// @warning Throws if the request is invalid
+Chessboard parse_request(std::string_view request);
+
+/**
+Resident server that scores boards received over a Unix domain socket
+
+A request is a board in the board file format or a FEN record, terminated by an empty line.
+Each request is answered by a line of `<white> <black>` scores, or `error: <message>`.
+A connection may send any number of requests without waiting, they are parsed and scored by the
+thread pool and the responses are written in request order. A connection with too many unwritten
+responses is not read until they are written, so its memory stays bounded. The socket is served by an epoll loop,
+so it is only available on Linux.
+*/
+class ScoreServer {
+public:
+    /**
+    Listen at given path, a stale socket file at the path is replaced
+
+    @param score_cache Shared by all connections, nullptr if disabled
+    @warning Throws if the socket cannot be listened or the platform is not Linux
+    */
+    ScoreServer(std::filesystem::path socket_path, ThreadPool& thread_pool, ScoreCache* score_cache);
+
+    /// Wait for the requests being scored, then close every connection and remove the socket file
+    ~ScoreServer();
+
+    ScoreServer(const ScoreServer&) = delete;
+    ScoreServer& operator=(const ScoreServer&) = delete;
+
+    /**
+    Serve connections until #stop is called
+
+    @warning Throws if the event loop fails, errors of a single connection only close that connection
+    */
+    void run();
+
+    /// Make #run return, safe to call from another thread or a signal handler
+    void stop() noexcept;
+
+private:
+    struct Connection;
+
+    /// Owns a file descriptor, which is closed on destruction
+    class FileDescriptor {
+    public:
+        FileDescriptor() noexcept = default;
+        ~FileDescriptor();
+
+        FileDescriptor(const FileDescriptor&) = delete;
+        FileDescriptor& operator=(const FileDescriptor&) = delete;
+
+        /// @returns -1 if none
+        int get() const noexcept { return fd; }
+
+        /// Close the owned descriptor and take the given one
+        void reset(int new_fd) noexcept;
+
+    private:
+        int fd = -1;
+    };
+
+    /// Response of a request scored by the thread pool
+    struct Completion {
+        std::uint64_t connection_id;
+        std::uint64_t sequence;
+        std::string response;
+    };
+
+    void accept_connections();
+
+    /// Read the available bytes and submit every complete request
+    void read_requests(Connection& connection);
+
+    /// Score a request by the thread pool, its response is collected by #collect_completions
+    void submit_request(Connection& connection, std::string request);
+
+    /// Move the responses of finished requests to their connections
+    void collect_completions();
+
+    /// Write the responses that are ready in request order, as much as the socket accepts
+    void write_responses(Connection& connection);
+
+    /// Close the connection if it is finished or failed, watch for writability if output is left and for readability unless backlogged
+    void update_connection(Connection& connection);
+
+    void close_connection(std::uint64_t connection_id) noexcept;
+
+    std::filesystem::path socket_path;
+    ThreadPool& thread_pool;
+    ScoreCache* score_cache;
+
+    FileDescriptor listen_fd;
+    FileDescriptor epoll_fd;
+    /// Wakes the event loop for completions and #stop
+    FileDescriptor event_fd;
+    std::atomic<bool> is_stopped = false;
+
+    std::uint64_t next_connection_id;
+    std::unordered_map<std::uint64_t, std::unique_ptr<Connection>> connections;
+
+    std::mutex completions_mutex;
+    std::vector<Completion> completions;
+};
+
+} // namespace chess
+
+#endif // CHESS_SCORE_CALCULATOR_SCORE_SERVER_HPP
@@ -0,0 +1,31 @@
+#ifndef CHESS_SCORE_CALCULATOR_SLIDING_ATTACKS_HPP
+#define CHESS_SCORE_CALCULATOR_SLIDING_ATTACKS_HPP
+
+////////////////////////////////////////////////////////////////////////////////
+// User Defined Libraries
+#include <chess_score_calculator/bitboard.hpp>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace chess {
+
+/**
+Attacks of pieces that slide until the first piece at each direction
+
+The blocking piece itself is included in the result regardless of its side.
+Lookups are performed by PEXT instruction when the library is compiled with BMI2 support,
+and by a bit scan per direction otherwise.
+
+@param square Bit index of the sliding piece
+@param occupancy Tiles occupied by any piece
+*/
+Bitboard get_bishop_attacks(int square, Bitboard occupancy) noexcept;
+
+/// @copydoc get_bishop_attacks
+Bitboard get_rook_attacks(int square, Bitboard occupancy) noexcept;
+
+/// @copydoc get_bishop_attacks
+Bitboard get_queen_attacks(int square, Bitboard occupancy) noexcept;
+
+} // namespace chess
+
+#endif // CHESS_SCORE_CALCULATOR_SLIDING_ATTACKS_HPP
@@ -0,0 +1,123 @@
+#ifndef CHESS_SCORE_CALCULATOR_STATS_HPP
+#define CHESS_SCORE_CALCULATOR_STATS_HPP
+
+////////////////////////////////////////////////////////////////////////////////
+// Standard Libraries
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+#include <string_view>
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+Instrumentation macros, they expand to nothing unless CHESS_SCORE_CALCULATOR_ENABLE_STATS is defined,
+so their arguments are not evaluated either
+
+CHESS_SCORE_CALCULATOR_STATS_ADD(Counter, value) adds to a #chess::stats::Counter.
+CHESS_SCORE_CALCULATOR_STATS_TIME(Phase) times a #chess::stats::Phase until the end of the enclosing scope.
+The functions below are only defined if enabled, otherwise only #chess::stats::is_enabled may be used.
+*/
+#ifdef CHESS_SCORE_CALCULATOR_ENABLE_STATS
+#define CHESS_SCORE_CALCULATOR_STATS_CONCAT_IMPL(lhs, rhs) lhs##rhs
+#define CHESS_SCORE_CALCULATOR_STATS_CONCAT(lhs, rhs) CHESS_SCORE_CALCULATOR_STATS_CONCAT_IMPL(lhs, rhs)
+#define CHESS_SCORE_CALCULATOR_STATS_ADD(counter, value) ::chess::stats::add(::chess::stats::Counter::counter, static_cast<std::uint64_t>(value))
+#define CHESS_SCORE_CALCULATOR_STATS_TIME(phase) \
+    const ::chess::stats::ScopedTimer CHESS_SCORE_CALCULATOR_STATS_CONCAT(stats_timer_, __LINE__)(::chess::stats::Phase::phase)
+#else
+#define CHESS_SCORE_CALCULATOR_STATS_ADD(counter, value) static_cast<void>(0)
+#define CHESS_SCORE_CALCULATOR_STATS_TIME(phase) static_cast<void>(0)
+#endif
+
+namespace chess::stats {
+
+#ifdef CHESS_SCORE_CALCULATOR_ENABLE_STATS
+constexpr bool is_enabled = true;
+#else
+constexpr bool is_enabled = false;
+#endif
+
+enum class Counter {
+    /// Boards parsed or decoded
+    Boards,
+    /// Files opened, i.e. board files and mapped inputs
+    Files,
+    /// Pieces of the parsed boards
+    Pieces,
+    /// Threatened pieces found
+    Threats,
+    /// Calls of operator new
+    Allocations,
+    AllocatedBytes,
+};
+
+constexpr size_t num_counters = 6;
+
+/// Phases of scoring a board, nested phases are excluded from the time of the enclosing one
+enum class Phase {
+    /// Opening, checking and mapping a board file
+    FileOpen,
+    /// Splitting a denotation into tiles
+    Tokenize,
+    /// Decoding a tile and placing its piece
+    PieceConstruction,
+    /// Attacks of the opponent pieces of each type
+    PawnThreats,
+    KnightThreats,
+    BishopThreats,
+    RookThreats,
+    QueenThreats,
+    KingThreats,
+    /// Summing the piece scores of a side
+    Reduction,
+    /// Threats and scores of a batch of boards, which are not split into the phases above
+    BatchScoring,
+};
+
+constexpr size_t num_phases = 11;
+
+std::string_view to_string(Counter counter) noexcept;
+std::string_view to_string(Phase phase) noexcept;
+
+/// Totals of all threads
+struct Snapshot {
+    std::array<std::uint64_t, num_counters> counters {};
+    std::array<std::uint64_t, num_phases> calls {};
+    std::array<std::uint64_t, num_phases> nanoseconds {};
+};
+
+/// @returns Totals of all threads, including finished ones
+Snapshot get_snapshot();
+
+/// Add to a counter of the calling thread, no other thread is synchronized
+void add(Counter counter, std::uint64_t value) noexcept;
+
+/// Add a call of a phase to the calling thread
+void add_time(Phase phase, std::uint64_t nanoseconds) noexcept;
+
+/// Times a phase excluding the phases timed meanwhile by the same thread
+class ScopedTimer {
+public:
+    explicit ScopedTimer(Phase phase) noexcept;
+    ~ScopedTimer();
+
+    ScopedTimer(const ScopedTimer&) = delete;
+    ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+private:
+    Phase phase;
+    std::chrono::steady_clock::time_point start;
+    /// Time of the nested timers
+    std::uint64_t nested_nanoseconds = 0;
+    ScopedTimer* parent;
+};
+
+/// Write totals and per board averages as a JSON object
+void write_json(std::ostream& os, const Snapshot& snapshot);
+
+/// Write totals in the Prometheus text exposition format
+void write_prometheus(std::ostream& os, const Snapshot& snapshot);
+
+} // namespace chess::stats
+
+#endif // CHESS_SCORE_CALCULATOR_STATS_HPP
@@ -0,0 +1,121 @@
+#ifndef CHESS_SCORE_CALCULATOR_THREAD_POOL_HPP
+#define CHESS_SCORE_CALCULATOR_THREAD_POOL_HPP
+
+////////////////////////////////////////////////////////////////////////////////
+// Standard Libraries
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace chess {
+
+/**
+Fixed number of worker threads with one task queue per worker
+
+Each worker runs its own queue in LIFO order and steals from the front of other queues when its own is empty.
+*/
+class ThreadPool {
+public:
+    /// @param num_threads Number of workers, 0 means one worker per hardware thread
+    explicit ThreadPool(unsigned num_threads = 0);
+
+    /// Finish all queued tasks and join the workers
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    unsigned get_num_threads() const noexcept;
+
+    /// Queue a task to a worker queue, which is the calling worker's own queue if called from a task
+    void submit(std::function<void()> task);
+
+    /**
+    Block until every submitted task is finished
+
+    @warning Must not be called from a task
+    @warning Rethrows the first exception thrown by a task since the last call
+    */
+    void wait();
+
+private:
+    struct Worker {
+        std::mutex mutex;
+        std::deque<std::function<void()>> tasks;
+    };
+
+    /// Main loop of worker at given index
+    void run(unsigned index);
+
+    /// Pop from the back of own queue, or steal from the front of another queue
+    bool try_pop(unsigned index, std::function<void()>& task);
+
+    std::vector<std::unique_ptr<Worker>> workers;
+    std::vector<std::thread> threads;
+    std::atomic<unsigned> next_worker = 0;
+
+    /// Tasks in the queues, counted after the push so it may briefly be negative while a pushed task is already popped
+    std::atomic<std::ptrdiff_t> num_queued = 0;
+    /// Submitted tasks that are not finished yet
+    std::atomic<size_t> num_unfinished = 0;
+    /// Workers waiting for a task, submit takes the mutex only when there are any
+    std::atomic<unsigned> num_sleeping = 0;
+
+    /// Guards the condition variables and the members below, the counters above are only read under it to sleep
+    std::mutex mutex;
+    std::condition_variable task_available;
+    std::condition_variable all_finished;
+    bool stopping = false;
+    std::exception_ptr first_exception;
+};
+
+/**
+Call function(i) for every i in [0, count) across the pool and wait for completion
+
+The range is split into more chunks than workers so that idle workers can steal the remaining chunks.
+@warning Rethrows the first exception thrown by function
+*/
+template <typename Function>
+void parallel_for(ThreadPool& pool, size_t count, const Function& function);
+
+} // namespace chess
+
+////////////////////////////////////////////////////////////////////////////////
+// INLINE DEFINITIONS
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Standard Libraries
+#include <algorithm>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace chess {
+
+template <typename Function>
+void parallel_for(ThreadPool& pool, size_t count, const Function& function)
+{
+    constexpr size_t chunks_per_thread = 8;
+    const size_t num_chunks = static_cast<size_t>(pool.get_num_threads()) * chunks_per_thread;
+    const size_t chunk_size = std::max<size_t>(1, (count + num_chunks - 1) / num_chunks);
+    for (size_t begin = 0; begin < count; begin += chunk_size) {
+        const size_t end = std::min(count, begin + chunk_size);
+        pool.submit([&function, begin, end] {
+            for (size_t i = begin; i < end; i++) {
+                function(i);
+            }
+        });
+    }
+    pool.wait();
+}
+
+} // namespace chess
+
+#endif // CHESS_SCORE_CALCULATOR_THREAD_POOL_HPP
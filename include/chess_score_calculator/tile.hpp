@@ -3,7 +3,8 @@
 
 ////////////////////////////////////////////////////////////////////////////////
 // Standard Libraries
-#include <memory>
+#include <optional>
+#include <type_traits>
 ////////////////////////////////////////////////////////////////////////////////
 // User Defined Libraries
 #include <chess_score_calculator/enums.hpp>
@@ -12,6 +13,7 @@
 
 namespace chess {
 
+/// Tile of a board, the piece is held inline
 class Tile {
 public:
     /// Default constructor, not intended for general use
@@ -21,7 +23,7 @@ public:
     explicit Tile(Coordinate coordinate) noexcept;
 
     /// Construct with piece
-    explicit Tile(std::unique_ptr<Piece> piece) noexcept;
+    explicit Tile(Piece piece) noexcept;
 
     bool has_piece() const noexcept;
 
@@ -39,9 +41,11 @@ public:
 
 private:
     Coordinate coordinate;
-    std::unique_ptr<Piece> piece;
+    std::optional<Piece> piece;
 };
 
+static_assert(std::is_trivially_copyable_v<Tile>);
+
 } // namespace chess
 
 #endif // CHESS_SCORE_CALCULATOR_TILE_HPP
@@ -0,0 +1,62 @@
+#ifndef CHESS_SCORE_CALCULATOR_ZOBRIST_HPP
+#define CHESS_SCORE_CALCULATOR_ZOBRIST_HPP
+
+////////////////////////////////////////////////////////////////////////////////
+// Standard Libraries
+#include <array>
+#include <cstdint>
+////////////////////////////////////////////////////////////////////////////////
+// User Defined Libraries
+#include <chess_score_calculator/enums.hpp>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace chess {
+
+/**
+@returns Random key of a piece at bit index
+
+The hash of a position is the XOR of the keys of its pieces, so it is updated by a single XOR per
+placed or removed piece. The keys are generated at compile time, so hashes are stable between runs.
+*/
+constexpr std::uint64_t get_zobrist_key(Side side, PieceType piece_type, int square) noexcept;
+
+} // namespace chess
+
+////////////////////////////////////////////////////////////////////////////////
+// INLINE DEFINITIONS
+////////////////////////////////////////////////////////////////////////////////
+
+namespace chess::zobrist_keys {
+
+/// @returns Next value of the SplitMix64 generator
+constexpr std::uint64_t split_mix(std::uint64_t& state) noexcept
+{
+    state += 0x9E3779B97F4A7C15;
+    std::uint64_t result = state;
+    result = (result ^ (result >> 30)) * 0xBF58476D1CE4E5B9;
+    result = (result ^ (result >> 27)) * 0x94D049BB133111EB;
+    return result ^ (result >> 31);
+}
+
+/// Indexed by (#Side * 6 + #PieceType) * 64 + bit index
+inline constexpr std::array<std::uint64_t, 2 * 6 * 64> keys = [] {
+    std::array<std::uint64_t, 2 * 6 * 64> result {};
+    std::uint64_t state = 0;
+    for (std::uint64_t& key : result) {
+        key = split_mix(state);
+    }
+    return result;
+}();
+
+} // namespace chess::zobrist_keys
+
+namespace chess {
+
+constexpr std::uint64_t get_zobrist_key(Side side, PieceType piece_type, int square) noexcept
+{
+    return zobrist_keys::keys[(static_cast<size_t>(side) * 6 + static_cast<size_t>(piece_type)) * 64 + static_cast<size_t>(square)];
+}
+
+} // namespace chess
+
+#endif // CHESS_SCORE_CALCULATOR_ZOBRIST_HPP
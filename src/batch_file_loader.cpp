@@ -0,0 +1,444 @@
+#include <chess_score_calculator/batch_file_loader.hpp>
+////////////////////////////////////////////////////////////////////////////////
+// Standard Libraries
+#include <algorithm>
+#include <bit>
+#include <cerrno>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <system_error>
+#include <vector>
+#ifdef __linux__
+#define CHESS_SCORE_CALCULATOR_HAS_IO_URING
+#include <atomic>
+#include <cstring>
+#include <fcntl.h>
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+#if defined(__unix__) || defined(__APPLE__)
+#define CHESS_SCORE_CALCULATOR_HAS_POSIX_READ
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+////////////////////////////////////////////////////////////////////////////////
+// User Defined Libraries
+#include <chess_score_calculator/stats.hpp>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+#ifdef CHESS_SCORE_CALCULATOR_HAS_IO_URING
+
+/// Operations of a file, the user data of a request is its file position times the number of operations plus the operation
+enum class Operation : std::uint64_t {
+    Open,
+    Read,
+    Close,
+};
+
+constexpr std::uint64_t num_operations = 3;
+
+[[noreturn]] void throw_system_error(const char* what)
+{
+    throw std::system_error(errno, std::generic_category(), what);
+}
+
+#endif
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace chess {
+
+FileBufferPool::FileBufferPool(size_t num_buffers, size_t buffer_size)
+    : buffer_size(buffer_size)
+    , memory(std::make_unique_for_overwrite<char[]>(num_buffers * buffer_size))
+    , free_buffers(num_buffers)
+{
+    for (std::uint32_t buffer_id = 0; buffer_id < num_buffers; buffer_id++) {
+        free_buffers.try_push(buffer_id);
+    }
+}
+
+std::uint32_t FileBufferPool::acquire()
+{
+    // the queue is never closed, so pop only returns with a buffer
+    return *free_buffers.pop();
+}
+
+std::optional<std::uint32_t> FileBufferPool::try_acquire()
+{
+    return free_buffers.try_pop();
+}
+
+void FileBufferPool::release(std::uint32_t buffer_id)
+{
+    free_buffers.push(buffer_id);
+}
+
+#ifdef CHESS_SCORE_CALCULATOR_HAS_IO_URING
+
+/**
+An io_uring instance mapped by raw system calls, so that liburing is not required
+
+Its submission queue holds the requests of a whole batch, and the completion queue is twice as large
+by default, so completions never overflow.
+*/
+struct BatchFileLoader::Ring {
+    /// @warning Throws if io_uring is not supported or not permitted
+    Ring(unsigned num_entries, unsigned num_files)
+    {
+        io_uring_params params {};
+        fd = static_cast<int>(::syscall(__NR_io_uring_setup, num_entries, &params));
+        if (fd == -1) {
+            throw_system_error("Cannot set up io_uring");
+        }
+        try {
+            map(params);
+            // every slot starts empty, the open requests fill them and the close requests empty them again
+            std::vector<int> files(num_files, -1);
+            if (::syscall(__NR_io_uring_register, fd, IORING_REGISTER_FILES, files.data(), num_files) == -1) {
+                throw_system_error("Cannot register io_uring files");
+            }
+        } catch (...) {
+            unmap();
+            throw;
+        }
+    }
+
+    ~Ring()
+    {
+        unmap();
+    }
+
+    Ring(const Ring&) = delete;
+    Ring& operator=(const Ring&) = delete;
+
+    /// @returns Cleared entry at the tail of the submission queue, which must not be full
+    io_uring_sqe& push_request()
+    {
+        const unsigned index = sq_tail_local++ & sq_mask;
+        sq_array[index] = index;
+        io_uring_sqe& result = sqes[index];
+        std::memset(&result, 0, sizeof(result));
+        return result;
+    }
+
+    /**
+    Submit the pushed requests and wait for the completion of every request
+
+    @param handle_completion Called by each completion
+    @warning Throws if io_uring_enter fails
+    */
+    template <typename Function>
+    void submit_and_wait(Function handle_completion)
+    {
+        std::atomic_ref<unsigned>(*sq_tail).store(sq_tail_local, std::memory_order_release);
+        const unsigned num_requests = sq_tail_local - sq_head_local;
+        unsigned num_submitted = 0;
+        unsigned num_completed = 0;
+        while (num_completed < num_requests) {
+            const long result = ::syscall(__NR_io_uring_enter, fd, num_requests - num_submitted, num_requests - num_completed, IORING_ENTER_GETEVENTS, nullptr, 0);
+            if (result >= 0) {
+                num_submitted += static_cast<unsigned>(result);
+            } else if ((errno != EINTR) && (errno != EAGAIN) && (errno != EBUSY)) {
+                throw_system_error("Cannot submit io_uring requests");
+            }
+            // the kernel waits only if everything is submitted, completions are reaped either way
+            const unsigned tail = std::atomic_ref<unsigned>(*cq_tail).load(std::memory_order_acquire);
+            unsigned head = *cq_head;
+            for (; head != tail; head++, num_completed++) {
+                handle_completion(cqes[head & cq_mask]);
+            }
+            std::atomic_ref<unsigned>(*cq_head).store(head, std::memory_order_release);
+        }
+        sq_head_local = sq_tail_local;
+    }
+
+    /**
+    Check that an open request installs the file into the file slot it is given
+
+    Kernels before 5.15 ignore the file slot of an open request and return a regular descriptor, which the
+    close requests would not close, and a close request by file slot would close descriptor 0 instead.
+    The probe opens /dev/null into the first slot and reads it by the slot.
+    @warning Throws if io_uring_enter fails
+    */
+    bool has_direct_descriptors()
+    {
+        // a regular descriptor is the lowest free one, so it is only 0 if descriptor 0 was not open
+        const bool was_fd_0_open = (::fcntl(0, F_GETFD) != -1);
+        io_uring_sqe& open_request = push_request();
+        open_request.opcode = IORING_OP_OPENAT;
+        open_request.fd = AT_FDCWD;
+        open_request.addr = reinterpret_cast<std::uint64_t>("/dev/null");
+        open_request.open_flags = O_RDONLY;
+        open_request.file_index = 1;
+        open_request.user_data = static_cast<std::uint64_t>(Operation::Open);
+        int open_result = -1;
+        submit_and_wait([&open_result](const io_uring_cqe& completion) { open_result = completion.res; });
+        if ((open_result > 0) || ((open_result == 0) && !was_fd_0_open && (::fcntl(0, F_GETFD) != -1))) {
+            ::close(open_result);
+            return false;
+        }
+        if (open_result < 0) {
+            return false;
+        }
+        // only a filled slot reaches here, so the close by slot is safe
+        char byte = 0;
+        io_uring_sqe& read_request = push_request();
+        read_request.opcode = IORING_OP_READ;
+        read_request.flags = IOSQE_FIXED_FILE | IOSQE_IO_HARDLINK;
+        read_request.fd = 0;
+        read_request.addr = reinterpret_cast<std::uint64_t>(&byte);
+        read_request.len = 1;
+        read_request.user_data = static_cast<std::uint64_t>(Operation::Read);
+        io_uring_sqe& close_request = push_request();
+        close_request.opcode = IORING_OP_CLOSE;
+        close_request.file_index = 1;
+        close_request.user_data = static_cast<std::uint64_t>(Operation::Close);
+        int read_result = -1;
+        submit_and_wait([&read_result](const io_uring_cqe& completion) {
+            if (static_cast<Operation>(completion.user_data) == Operation::Read) {
+                read_result = completion.res;
+            }
+        });
+        // reading /dev/null by a filled slot reaches the end of file at once
+        return read_result == 0;
+    }
+
+private:
+    void map(const io_uring_params& params)
+    {
+        sq_ring_size = params.sq_off.array + (params.sq_entries * sizeof(unsigned));
+        cq_ring_size = params.cq_off.cqes + (params.cq_entries * sizeof(io_uring_cqe));
+        const bool is_single_map = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+        if (is_single_map) {
+            sq_ring_size = cq_ring_size = std::max(sq_ring_size, cq_ring_size);
+        }
+        sq_ring = ::mmap(nullptr, sq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING);
+        if (sq_ring == MAP_FAILED) {
+            throw_system_error("Cannot map io_uring");
+        }
+        if (is_single_map) {
+            cq_ring = sq_ring;
+        } else {
+            cq_ring = ::mmap(nullptr, cq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_CQ_RING);
+            if (cq_ring == MAP_FAILED) {
+                throw_system_error("Cannot map io_uring");
+            }
+        }
+        sqes_size = params.sq_entries * sizeof(io_uring_sqe);
+        void* sqes_memory = ::mmap(nullptr, sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES);
+        if (sqes_memory == MAP_FAILED) {
+            throw_system_error("Cannot map io_uring");
+        }
+        sqes = static_cast<io_uring_sqe*>(sqes_memory);
+
+        char* sq_base = static_cast<char*>(sq_ring);
+        sq_tail = reinterpret_cast<unsigned*>(sq_base + params.sq_off.tail);
+        sq_mask = *reinterpret_cast<unsigned*>(sq_base + params.sq_off.ring_mask);
+        sq_array = reinterpret_cast<unsigned*>(sq_base + params.sq_off.array);
+        sq_head_local = sq_tail_local = *sq_tail;
+        char* cq_base = static_cast<char*>(cq_ring);
+        cq_head = reinterpret_cast<unsigned*>(cq_base + params.cq_off.head);
+        cq_tail = reinterpret_cast<unsigned*>(cq_base + params.cq_off.tail);
+        cq_mask = *reinterpret_cast<unsigned*>(cq_base + params.cq_off.ring_mask);
+        cqes = reinterpret_cast<io_uring_cqe*>(cq_base + params.cq_off.cqes);
+    }
+
+    void unmap() noexcept
+    {
+        if (sqes) {
+            ::munmap(sqes, sqes_size);
+        }
+        if ((cq_ring != MAP_FAILED) && (cq_ring != sq_ring)) {
+            ::munmap(cq_ring, cq_ring_size);
+        }
+        if (sq_ring != MAP_FAILED) {
+            ::munmap(sq_ring, sq_ring_size);
+        }
+        ::close(fd);
+    }
+
+    int fd = -1;
+    void* sq_ring = MAP_FAILED;
+    size_t sq_ring_size = 0;
+    void* cq_ring = MAP_FAILED;
+    size_t cq_ring_size = 0;
+    io_uring_sqe* sqes = nullptr;
+    size_t sqes_size = 0;
+
+    unsigned* sq_tail = nullptr;
+    unsigned sq_mask = 0;
+    unsigned* sq_array = nullptr;
+    /// Tail of the pushed requests and tail at the last submission, only this thread writes the submission queue
+    unsigned sq_tail_local = 0;
+    unsigned sq_head_local = 0;
+    unsigned* cq_head = nullptr;
+    unsigned* cq_tail = nullptr;
+    unsigned cq_mask = 0;
+    io_uring_cqe* cqes = nullptr;
+};
+
+#else
+
+/// Never constructed without io_uring
+struct BatchFileLoader::Ring {
+};
+
+#endif
+
+BatchFileLoader::BatchFileLoader(FileBufferPool& buffer_pool, unsigned max_batch_size, bool is_io_uring_requested)
+    : buffer_pool(buffer_pool)
+    , max_batch_size(std::max(max_batch_size, 1U))
+{
+#ifdef CHESS_SCORE_CALCULATOR_HAS_IO_URING
+    if (is_io_uring_requested) {
+        try {
+            ring = std::make_unique<Ring>(std::bit_ceil(static_cast<unsigned>(num_operations) * this->max_batch_size), this->max_batch_size);
+            if (!ring->has_direct_descriptors()) {
+                ring.reset();
+            }
+        } catch (const std::system_error&) {
+            // files are read one by one instead
+        }
+    }
+#else
+    static_cast<void>(is_io_uring_requested);
+#endif
+}
+
+BatchFileLoader::~BatchFileLoader() = default;
+
+std::vector<LoadedFile> BatchFileLoader::load(std::span<const std::filesystem::path* const> files)
+{
+    CHESS_SCORE_CALCULATOR_STATS_TIME(FileOpen);
+    const size_t max_num_files = std::min<size_t>(files.size(), max_batch_size);
+    std::vector<std::uint32_t> buffer_ids;
+    if (max_num_files != 0) {
+        buffer_ids.push_back(buffer_pool.acquire());
+    }
+    while (buffer_ids.size() < max_num_files) {
+        const std::optional<std::uint32_t> buffer_id = buffer_pool.try_acquire();
+        if (!buffer_id) {
+            break;
+        }
+        buffer_ids.push_back(*buffer_id);
+    }
+    CHESS_SCORE_CALCULATOR_STATS_ADD(Files, buffer_ids.size());
+    if (!ring) {
+        return load_synchronously(files.first(buffer_ids.size()), buffer_ids);
+    }
+
+#ifdef CHESS_SCORE_CALCULATOR_HAS_IO_URING
+    std::vector<LoadedFile> result(buffer_ids.size());
+    for (std::uint32_t i = 0; i < buffer_ids.size(); i++) {
+        const std::span<char> buffer = buffer_pool.get_buffer(buffer_ids[i]);
+        result[i].buffer_id = buffer_ids[i];
+        // hard links run the read and the close even if the open fails, so no file slot is left open,
+        // and the close is by file slot, which the constructor checked the kernel supports
+        io_uring_sqe& open_request = ring->push_request();
+        open_request.opcode = IORING_OP_OPENAT;
+        open_request.flags = IOSQE_IO_HARDLINK;
+        open_request.fd = AT_FDCWD;
+        open_request.addr = reinterpret_cast<std::uint64_t>(files[i]->c_str());
+        open_request.open_flags = O_RDONLY;
+        open_request.file_index = i + 1;
+        open_request.user_data = (i * num_operations) + static_cast<std::uint64_t>(Operation::Open);
+        io_uring_sqe& read_request = ring->push_request();
+        read_request.opcode = IORING_OP_READ;
+        read_request.flags = IOSQE_FIXED_FILE | IOSQE_IO_HARDLINK;
+        read_request.fd = static_cast<int>(i);
+        read_request.addr = reinterpret_cast<std::uint64_t>(buffer.data());
+        read_request.len = static_cast<std::uint32_t>(buffer.size());
+        read_request.user_data = (i * num_operations) + static_cast<std::uint64_t>(Operation::Read);
+        io_uring_sqe& close_request = ring->push_request();
+        close_request.opcode = IORING_OP_CLOSE;
+        close_request.file_index = i + 1;
+        close_request.user_data = (i * num_operations) + static_cast<std::uint64_t>(Operation::Close);
+    }
+    ring->submit_and_wait([&result](const io_uring_cqe& completion) {
+        LoadedFile& loaded_file = result[completion.user_data / num_operations];
+        switch (static_cast<Operation>(completion.user_data % num_operations)) {
+        case Operation::Open:
+            loaded_file.open_error = (completion.res < 0) ? -completion.res : 0;
+            break;
+        case Operation::Read:
+            loaded_file.read_error = (completion.res < 0) ? -completion.res : 0;
+            loaded_file.size = (completion.res < 0) ? 0 : static_cast<size_t>(completion.res);
+            break;
+        case Operation::Close:
+            break;
+        }
+    });
+    // the read of a file that failed to open fails on the empty file slot, only the open error is reported
+    for (LoadedFile& loaded_file : result) {
+        if (loaded_file.open_error != 0) {
+            loaded_file.read_error = 0;
+            loaded_file.size = 0;
+        }
+    }
+    return result;
+#else
+    return {};
+#endif
+}
+
+std::vector<LoadedFile> BatchFileLoader::load_synchronously(std::span<const std::filesystem::path* const> files, std::span<const std::uint32_t> buffer_ids)
+{
+    std::vector<LoadedFile> result(buffer_ids.size());
+    for (size_t i = 0; i < buffer_ids.size(); i++) {
+        result[i].buffer_id = buffer_ids[i];
+        const std::span<char> buffer = buffer_pool.get_buffer(buffer_ids[i]);
+#ifdef CHESS_SCORE_CALCULATOR_HAS_POSIX_READ
+        // the same calls as the io_uring requests, so both report the same errors, e.g. a directory opens but fails to read
+        const int fd = ::open(files[i]->c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd == -1) {
+            result[i].open_error = errno;
+            continue;
+        }
+        size_t size = 0;
+        while (size < buffer.size()) {
+            const ssize_t read_size = ::read(fd, buffer.data() + size, buffer.size() - size);
+            if (read_size == -1) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                result[i].read_error = errno;
+                size = 0;
+                break;
+            }
+            if (read_size == 0) {
+                break;
+            }
+            size += static_cast<size_t>(read_size);
+        }
+        result[i].size = size;
+        ::close(fd);
+#else
+        errno = 0;
+        std::ifstream ifs(*files[i], std::ios_base::binary);
+        if (!ifs.is_open()) {
+            result[i].open_error = (errno != 0) ? errno : ENOENT;
+            continue;
+        }
+        try {
+            result[i].size = static_cast<size_t>(ifs.rdbuf()->sgetn(buffer.data(), static_cast<std::streamsize>(buffer.size())));
+        } catch (const std::ios_base::failure&) {
+            result[i].read_error = EIO;
+        }
+#endif
+    }
+    return result;
+}
+
+} // namespace chess
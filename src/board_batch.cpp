@@ -0,0 +1,194 @@
+#include <chess_score_calculator/board_batch.hpp>
+////////////////////////////////////////////////////////////////////////////////
+// Standard Libraries
+#include <bit>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+////////////////////////////////////////////////////////////////////////////////
+// User Defined Libraries
+#include "board_batch_kernel.hpp"
+#include <chess_score_calculator/piece.hpp>
+#include <chess_score_calculator/stats.hpp>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+/// Single board per "vector", used where no vector instruction set is available and for the trailing boards
+class ScalarLanes {
+public:
+    static constexpr size_t width = 1;
+
+    ScalarLanes() = default;
+
+    static ScalarLanes load(const Bitboard* bitboards) noexcept { return ScalarLanes(*bitboards); }
+    static ScalarLanes broadcast(Bitboard bitboard) noexcept { return ScalarLanes(bitboard); }
+    void store(std::uint64_t* values) const noexcept { *values = value; }
+
+    friend ScalarLanes operator&(const ScalarLanes& lhs, const ScalarLanes& rhs) noexcept { return ScalarLanes(lhs.value & rhs.value); }
+    friend ScalarLanes operator|(const ScalarLanes& lhs, const ScalarLanes& rhs) noexcept { return ScalarLanes(lhs.value | rhs.value); }
+    friend ScalarLanes operator^(const ScalarLanes& lhs, const ScalarLanes& rhs) noexcept { return ScalarLanes(lhs.value ^ rhs.value); }
+    friend ScalarLanes operator+(const ScalarLanes& lhs, const ScalarLanes& rhs) noexcept { return ScalarLanes(lhs.value + rhs.value); }
+    ScalarLanes operator~() const noexcept { return ScalarLanes(~value); }
+    ScalarLanes operator<<(int shift) const noexcept { return ScalarLanes(value << shift); }
+    ScalarLanes operator>>(int shift) const noexcept { return ScalarLanes(value >> shift); }
+
+    /// @returns Number of tiles at each lane
+    friend ScalarLanes popcount(const ScalarLanes& lanes) noexcept { return ScalarLanes(static_cast<std::uint64_t>(std::popcount(lanes.value))); }
+
+    /// @warning Each lane must fit in 32 bits
+    friend ScalarLanes multiply(const ScalarLanes& lanes, std::uint32_t factor) noexcept { return ScalarLanes(lanes.value * factor); }
+
+private:
+    explicit ScalarLanes(std::uint64_t value) noexcept
+        : value(value)
+    {
+    }
+
+    std::uint64_t value = 0;
+};
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace chess {
+
+// the kernels cannot include the piece header, so keep their copy of the scores in sync
+static_assert(batch_kernels::piece_scores[0] == get_piece_score(PieceType::Pawn));
+static_assert(batch_kernels::piece_scores[1] == get_piece_score(PieceType::Knight));
+static_assert(batch_kernels::piece_scores[2] == get_piece_score(PieceType::Bishop));
+static_assert(batch_kernels::piece_scores[3] == get_piece_score(PieceType::Rook));
+static_assert(batch_kernels::piece_scores[4] == get_piece_score(PieceType::Queen));
+static_assert(batch_kernels::piece_scores[5] == get_piece_score(PieceType::King));
+
+void BoardBatch::reserve(size_t num_boards)
+{
+    for (std::vector<Bitboard>& bitboards_of_type : bitboards) {
+        bitboards_of_type.reserve(num_boards);
+    }
+}
+
+void BoardBatch::push_back(const Chessboard& chessboard)
+{
+    for (int side = 0; side < 2; side++) {
+        for (int type = 0; type < 6; type++) {
+            const Bitboard bitboard = chessboard.get_bitboard(static_cast<Side>(side)) & chessboard.get_bitboard(static_cast<PieceType>(type));
+            bitboards[side * 6 + type].push_back(bitboard);
+        }
+    }
+}
+
+void BoardBatch::clear() noexcept
+{
+    for (std::vector<Bitboard>& bitboards_of_type : bitboards) {
+        bitboards_of_type.clear();
+    }
+}
+
+size_t BoardBatch::size() const noexcept
+{
+    return bitboards[0].size();
+}
+
+std::span<const Bitboard> BoardBatch::get_bitboards(Side side, PieceType piece_type) const noexcept
+{
+    return bitboards[static_cast<size_t>(side) * 6 + static_cast<size_t>(piece_type)];
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+std::string_view to_string(BatchKernel batch_kernel) noexcept
+{
+    switch (batch_kernel) {
+    case BatchKernel::Scalar:
+        return "scalar";
+    case BatchKernel::Avx2:
+        return "avx2";
+    case BatchKernel::Avx512:
+        return "avx512";
+    }
+    return "unknown";
+}
+
+bool is_supported(BatchKernel batch_kernel) noexcept
+{
+    switch (batch_kernel) {
+    case BatchKernel::Scalar:
+        return true;
+#ifdef CHESS_SCORE_CALCULATOR_HAS_X86_KERNELS
+    case BatchKernel::Avx2:
+        return __builtin_cpu_supports("avx2");
+    case BatchKernel::Avx512:
+        return __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw");
+#else
+    case BatchKernel::Avx2:
+    case BatchKernel::Avx512:
+        return false;
+#endif
+    }
+    return false;
+}
+
+BatchKernel get_batch_kernel() noexcept
+{
+    static const BatchKernel result = is_supported(BatchKernel::Avx512) ? BatchKernel::Avx512
+        : is_supported(BatchKernel::Avx2)                                ? BatchKernel::Avx2
+                                                                         : BatchKernel::Scalar;
+    return result;
+}
+
+void score_batch(const BoardBatch& board_batch, std::span<Score> scores)
+{
+    score_batch(board_batch, scores, get_batch_kernel());
+}
+
+void score_batch(const BoardBatch& board_batch, std::span<Score> scores, BatchKernel batch_kernel)
+{
+    if (scores.size() != board_batch.size()) {
+        throw std::invalid_argument("Number of scores " + std::to_string(scores.size()) + " differs from number of boards " + std::to_string(board_batch.size()));
+    }
+    CHESS_SCORE_CALCULATOR_STATS_TIME(BatchScoring);
+    if (!is_supported(batch_kernel)) {
+        throw std::invalid_argument("Batch kernel is not supported: " + std::string(to_string(batch_kernel)));
+    }
+    batch_kernels::BatchView batch_view {};
+    for (int side = 0; side < 2; side++) {
+        for (int type = 0; type < 6; type++) {
+            batch_view.bitboards[side * 6 + type] = board_batch.get_bitboards(static_cast<Side>(side), static_cast<PieceType>(type)).data();
+        }
+    }
+    batch_view.size = board_batch.size();
+    // score whole vectors, then the trailing boards one by one
+    size_t num_scored = 0;
+    switch (batch_kernel) {
+    case BatchKernel::Scalar:
+        break;
+#ifdef CHESS_SCORE_CALCULATOR_HAS_X86_KERNELS
+    case BatchKernel::Avx2:
+        num_scored = batch_kernels::score_avx2(batch_view, scores.data());
+        break;
+    case BatchKernel::Avx512:
+        num_scored = batch_kernels::score_avx512(batch_view, scores.data());
+        break;
+#else
+    case BatchKernel::Avx2:
+    case BatchKernel::Avx512:
+        break;
+#endif
+    }
+    for (Bitboard const*& bitboards : batch_view.bitboards) {
+        bitboards += num_scored;
+    }
+    batch_view.size -= num_scored;
+    batch_kernels::score_scalar(batch_view, scores.data() + num_scored);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+size_t batch_kernels::score_scalar(const BatchView& batch_view, Score* scores) noexcept
+{
+    return score_whole_vectors<ScalarLanes>(batch_view, scores);
+}
+
+} // namespace chess
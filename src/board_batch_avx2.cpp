@@ -0,0 +1,65 @@
+/// @file Batch scoring kernel compiled with AVX2 support, 4 boards per vector
+#include "board_batch_kernel.hpp"
+////////////////////////////////////////////////////////////////////////////////
+// Standard Libraries
+#include <immintrin.h>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+class Avx2Lanes {
+public:
+    static constexpr size_t width = 4;
+
+    Avx2Lanes() noexcept
+        : value(_mm256_setzero_si256())
+    {
+    }
+
+    static Avx2Lanes load(const Bitboard* bitboards) noexcept { return Avx2Lanes(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(bitboards))); }
+    static Avx2Lanes broadcast(Bitboard bitboard) noexcept { return Avx2Lanes(_mm256_set1_epi64x(static_cast<long long>(bitboard))); }
+    void store(std::uint64_t* values) const noexcept { _mm256_storeu_si256(reinterpret_cast<__m256i*>(values), value); }
+
+    friend Avx2Lanes operator&(const Avx2Lanes& lhs, const Avx2Lanes& rhs) noexcept { return Avx2Lanes(_mm256_and_si256(lhs.value, rhs.value)); }
+    friend Avx2Lanes operator|(const Avx2Lanes& lhs, const Avx2Lanes& rhs) noexcept { return Avx2Lanes(_mm256_or_si256(lhs.value, rhs.value)); }
+    friend Avx2Lanes operator^(const Avx2Lanes& lhs, const Avx2Lanes& rhs) noexcept { return Avx2Lanes(_mm256_xor_si256(lhs.value, rhs.value)); }
+    friend Avx2Lanes operator+(const Avx2Lanes& lhs, const Avx2Lanes& rhs) noexcept { return Avx2Lanes(_mm256_add_epi64(lhs.value, rhs.value)); }
+    Avx2Lanes operator~() const noexcept { return Avx2Lanes(_mm256_xor_si256(value, _mm256_set1_epi64x(-1))); }
+    Avx2Lanes operator<<(int shift) const noexcept { return Avx2Lanes(_mm256_sll_epi64(value, _mm_cvtsi32_si128(shift))); }
+    Avx2Lanes operator>>(int shift) const noexcept { return Avx2Lanes(_mm256_srl_epi64(value, _mm_cvtsi32_si128(shift))); }
+
+    /// @returns Number of tiles at each lane, counted per nibble by a lookup table
+    friend Avx2Lanes popcount(const Avx2Lanes& lanes) noexcept
+    {
+        const __m256i lookup = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4, 0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+        const __m256i low_nibbles = _mm256_set1_epi8(0x0F);
+        const __m256i low_counts = _mm256_shuffle_epi8(lookup, _mm256_and_si256(lanes.value, low_nibbles));
+        const __m256i high_counts = _mm256_shuffle_epi8(lookup, _mm256_and_si256(_mm256_srli_epi16(lanes.value, 4), low_nibbles));
+        // sum the byte counts of each lane
+        return Avx2Lanes(_mm256_sad_epu8(_mm256_add_epi8(low_counts, high_counts), _mm256_setzero_si256()));
+    }
+
+    /// @warning Each lane must fit in 32 bits
+    friend Avx2Lanes multiply(const Avx2Lanes& lanes, std::uint32_t factor) noexcept { return Avx2Lanes(_mm256_mul_epu32(lanes.value, _mm256_set1_epi64x(factor))); }
+
+private:
+    explicit Avx2Lanes(__m256i value) noexcept
+        : value(value)
+    {
+    }
+
+    __m256i value;
+};
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace chess {
+
+size_t batch_kernels::score_avx2(const BatchView& batch_view, Score* scores) noexcept
+{
+    return score_whole_vectors<Avx2Lanes>(batch_view, scores);
+}
+
+} // namespace chess
@@ -0,0 +1,71 @@
+/// @file Batch scoring kernel compiled with AVX-512 F and BW support, 8 boards per vector
+#include "board_batch_kernel.hpp"
+////////////////////////////////////////////////////////////////////////////////
+// Standard Libraries
+#include <immintrin.h>
+////////////////////////////////////////////////////////////////////////////////
+
+// GCC 12 intrinsics pass an intentionally undefined vector as the merge operand, which it then reports
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+namespace {
+
+class Avx512Lanes {
+public:
+    static constexpr size_t width = 8;
+
+    Avx512Lanes() noexcept
+        : value(_mm512_setzero_si512())
+    {
+    }
+
+    static Avx512Lanes load(const Bitboard* bitboards) noexcept { return Avx512Lanes(_mm512_loadu_si512(bitboards)); }
+    static Avx512Lanes broadcast(Bitboard bitboard) noexcept { return Avx512Lanes(_mm512_set1_epi64(static_cast<long long>(bitboard))); }
+    void store(std::uint64_t* values) const noexcept { _mm512_storeu_si512(values, value); }
+
+    friend Avx512Lanes operator&(const Avx512Lanes& lhs, const Avx512Lanes& rhs) noexcept { return Avx512Lanes(_mm512_and_si512(lhs.value, rhs.value)); }
+    friend Avx512Lanes operator|(const Avx512Lanes& lhs, const Avx512Lanes& rhs) noexcept { return Avx512Lanes(_mm512_or_si512(lhs.value, rhs.value)); }
+    friend Avx512Lanes operator^(const Avx512Lanes& lhs, const Avx512Lanes& rhs) noexcept { return Avx512Lanes(_mm512_xor_si512(lhs.value, rhs.value)); }
+    friend Avx512Lanes operator+(const Avx512Lanes& lhs, const Avx512Lanes& rhs) noexcept { return Avx512Lanes(_mm512_add_epi64(lhs.value, rhs.value)); }
+    Avx512Lanes operator~() const noexcept { return Avx512Lanes(_mm512_xor_si512(value, _mm512_set1_epi64(-1))); }
+    Avx512Lanes operator<<(int shift) const noexcept { return Avx512Lanes(_mm512_sll_epi64(value, _mm_cvtsi32_si128(shift))); }
+    Avx512Lanes operator>>(int shift) const noexcept { return Avx512Lanes(_mm512_srl_epi64(value, _mm_cvtsi32_si128(shift))); }
+
+    /// @returns Number of tiles at each lane, counted per nibble by a lookup table
+    friend Avx512Lanes popcount(const Avx512Lanes& lanes) noexcept
+    {
+        const __m512i lookup = _mm512_broadcast_i32x4(_mm_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4));
+        const __m512i low_nibbles = _mm512_set1_epi8(0x0F);
+        const __m512i low_counts = _mm512_shuffle_epi8(lookup, _mm512_and_si512(lanes.value, low_nibbles));
+        const __m512i high_counts = _mm512_shuffle_epi8(lookup, _mm512_and_si512(_mm512_srli_epi16(lanes.value, 4), low_nibbles));
+        // sum the byte counts of each lane
+        return Avx512Lanes(_mm512_sad_epu8(_mm512_add_epi8(low_counts, high_counts), _mm512_setzero_si512()));
+    }
+
+    /// @warning Each lane must fit in 32 bits
+    friend Avx512Lanes multiply(const Avx512Lanes& lanes, std::uint32_t factor) noexcept { return Avx512Lanes(_mm512_mul_epu32(lanes.value, _mm512_set1_epi64(factor))); }
+
+private:
+    explicit Avx512Lanes(__m512i value) noexcept
+        : value(value)
+    {
+    }
+
+    __m512i value;
+};
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace chess {
+
+size_t batch_kernels::score_avx512(const BatchView& batch_view, Score* scores) noexcept
+{
+    return score_whole_vectors<Avx512Lanes>(batch_view, scores);
+}
+
+} // namespace chess
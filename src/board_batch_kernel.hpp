@@ -0,0 +1,179 @@
+#ifndef CHESS_SCORE_CALCULATOR_BOARD_BATCH_KERNEL_HPP
+#define CHESS_SCORE_CALCULATOR_BOARD_BATCH_KERNEL_HPP
+
+/**
+@file
+Internal header of the batch scoring kernels
+
+Each instruction set has its own translation unit that is compiled with the matching flags.
+Everything such a translation unit instantiates lives in an anonymous namespace and the batch is
+passed as raw pointers, so no inline function compiled with wider instructions can be picked by the
+linker for the other translation units.
+*/
+
+////////////////////////////////////////////////////////////////////////////////
+// Standard Libraries
+#include <cstddef>
+#include <cstdint>
+////////////////////////////////////////////////////////////////////////////////
+// User Defined Libraries
+#include <chess_score_calculator/bitboard.hpp>
+#include <chess_score_calculator/chessboard.hpp>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace chess::batch_kernels {
+
+/// Batch as raw pointers
+struct BatchView {
+    /// Indexed by #Side * 6 + #PieceType, each one has #size elements
+    const Bitboard* bitboards[12];
+    size_t size;
+};
+
+/// Scores of unthreatened pieces indexed by #PieceType, threatened pieces count as half
+constexpr std::uint32_t piece_scores[6] = { 1, 3, 3, 5, 9, 100 };
+
+/**
+Score the leading boards of a batch
+
+Only whole vectors are scored, the remaining boards are left to the scalar kernel.
+@returns Number of boards scored
+*/
+size_t score_scalar(const BatchView& batch_view, Score* scores) noexcept;
+
+#ifdef CHESS_SCORE_CALCULATOR_HAS_X86_KERNELS
+/// @copydoc score_scalar
+size_t score_avx2(const BatchView& batch_view, Score* scores) noexcept;
+
+/// @copydoc score_scalar
+size_t score_avx512(const BatchView& batch_view, Score* scores) noexcept;
+#endif
+
+} // namespace chess::batch_kernels
+
+////////////////////////////////////////////////////////////////////////////////
+// INLINE DEFINITIONS
+////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+using chess::Bitboard;
+
+constexpr Bitboard not_a_file = ~Bitboard { 0x0101010101010101 };
+constexpr Bitboard not_ab_files = ~Bitboard { 0x0303030303030303 };
+constexpr Bitboard not_h_file = ~Bitboard { 0x8080808080808080 };
+constexpr Bitboard not_gh_files = ~Bitboard { 0xC0C0C0C0C0C0C0C0 };
+
+/// Shift every lane towards h8 by a positive amount, towards a1 by a negative amount
+template <int shift, typename Lanes>
+Lanes shift_lanes(const Lanes& lanes) noexcept
+{
+    if constexpr (shift > 0) {
+        return lanes << shift;
+    } else {
+        return lanes >> -shift;
+    }
+}
+
+/// Shift towards a direction and drop the tiles that wrapped around the board edge
+template <int shift, Bitboard wrap_mask, typename Lanes>
+Lanes shift_direction(const Lanes& lanes) noexcept
+{
+    return shift_lanes<shift>(lanes) & Lanes::broadcast(wrap_mask);
+}
+
+/// Attacks of sliders along a direction by Kogge-Stone fill, stopping at the first occupied tile
+template <int shift, Bitboard wrap_mask, typename Lanes>
+Lanes get_ray_attacks(Lanes sliders, const Lanes& empty) noexcept
+{
+    Lanes propagator = empty & Lanes::broadcast(wrap_mask);
+    sliders = sliders | (propagator & shift_lanes<shift>(sliders));
+    propagator = propagator & shift_lanes<shift>(propagator);
+    sliders = sliders | (propagator & shift_lanes<2 * shift>(sliders));
+    propagator = propagator & shift_lanes<2 * shift>(propagator);
+    sliders = sliders | (propagator & shift_lanes<4 * shift>(sliders));
+    return shift_direction<shift, wrap_mask>(sliders);
+}
+
+/// @param pieces Indexed by #PieceType
+template <typename Lanes>
+Lanes get_side_attacks(const Lanes (&pieces)[6], bool is_white, const Lanes& empty) noexcept
+{
+    const Lanes& pawns = pieces[0];
+    const Lanes& knights = pieces[1];
+    const Lanes orthogonals = pieces[3] | pieces[4];
+    const Lanes diagonals = pieces[2] | pieces[4];
+    const Lanes& kings = pieces[5];
+    Lanes result = is_white
+        ? shift_direction<7, not_h_file>(pawns) | shift_direction<9, not_a_file>(pawns)
+        : shift_direction<-9, not_h_file>(pawns) | shift_direction<-7, not_a_file>(pawns);
+    result = result | shift_direction<17, not_a_file>(knights) | shift_direction<15, not_h_file>(knights)
+        | shift_direction<10, not_ab_files>(knights) | shift_direction<6, not_gh_files>(knights)
+        | shift_direction<-17, not_h_file>(knights) | shift_direction<-15, not_a_file>(knights)
+        | shift_direction<-10, not_gh_files>(knights) | shift_direction<-6, not_ab_files>(knights);
+    const Lanes king_sides = shift_direction<1, not_a_file>(kings) | shift_direction<-1, not_h_file>(kings);
+    const Lanes king_row = kings | king_sides;
+    result = result | king_sides | shift_lanes<8>(king_row) | shift_lanes<-8>(king_row);
+    result = result | get_ray_attacks<8, ~Bitboard { 0 }>(orthogonals, empty) | get_ray_attacks<-8, ~Bitboard { 0 }>(orthogonals, empty)
+        | get_ray_attacks<1, not_a_file>(orthogonals, empty) | get_ray_attacks<-1, not_h_file>(orthogonals, empty);
+    result = result | get_ray_attacks<9, not_a_file>(diagonals, empty) | get_ray_attacks<7, not_h_file>(diagonals, empty)
+        | get_ray_attacks<-7, not_a_file>(diagonals, empty) | get_ray_attacks<-9, not_h_file>(diagonals, empty);
+    return result;
+}
+
+/// @returns Half points of a side, i.e. each unthreatened piece counts twice its score
+template <typename Lanes>
+Lanes get_half_points(const Lanes (&pieces)[6], const Lanes& threatened) noexcept
+{
+    Lanes result;
+    for (int type = 0; type < 6; type++) {
+        const Lanes counts = popcount(pieces[type]) + popcount(pieces[type] & ~threatened);
+        result = result + multiply(counts, chess::batch_kernels::piece_scores[type]);
+    }
+    return result;
+}
+
+/**
+Score the boards [index, index + Lanes::width) of a batch
+
+@tparam Lanes Bitboards of consecutive boards, one per lane
+*/
+template <typename Lanes>
+void score_lanes(const chess::batch_kernels::BatchView& batch_view, size_t index, chess::Score* scores) noexcept
+{
+    Lanes pieces[2][6];
+    Lanes occupancy;
+    for (int side = 0; side < 2; side++) {
+        for (int type = 0; type < 6; type++) {
+            pieces[side][type] = Lanes::load(batch_view.bitboards[side * 6 + type] + index);
+            occupancy = occupancy | pieces[side][type];
+        }
+    }
+    const Lanes empty = ~occupancy;
+    const Lanes white_attacks = get_side_attacks(pieces[0], true, empty);
+    const Lanes black_attacks = get_side_attacks(pieces[1], false, empty);
+    // a piece of a side is threatened if any opponent piece attacks it, so own pieces can be included
+    std::uint64_t white_half_points[Lanes::width];
+    std::uint64_t black_half_points[Lanes::width];
+    get_half_points(pieces[0], black_attacks).store(white_half_points);
+    get_half_points(pieces[1], white_attacks).store(black_half_points);
+    // convert only at output
+    for (size_t i = 0; i < Lanes::width; i++) {
+        scores[index + i] = chess::Score { white_half_points[i] / 2.0, black_half_points[i] / 2.0 };
+    }
+}
+
+/// @returns Number of boards scored, i.e. the boards of whole vectors
+template <typename Lanes>
+size_t score_whole_vectors(const chess::batch_kernels::BatchView& batch_view, chess::Score* scores) noexcept
+{
+    const size_t end = batch_view.size - batch_view.size % Lanes::width;
+    for (size_t index = 0; index < end; index += Lanes::width) {
+        score_lanes<Lanes>(batch_view, index, scores);
+    }
+    return end;
+}
+
+} // namespace
+
+#endif // CHESS_SCORE_CALCULATOR_BOARD_BATCH_KERNEL_HPP
@@ -0,0 +1,144 @@
+#include <chess_score_calculator/board_file_list.hpp>
+////////////////////////////////////////////////////////////////////////////////
+// Standard Libraries
+#include <filesystem>
+#include <istream>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+/**
+Match a character against the set starting after `[` at position
+
+@param position Moved past the closing `]`
+@returns Empty if the set is not closed, then `[` is an ordinary character
+*/
+std::optional<bool> match_set(std::string_view pattern, size_t& position, char ch) noexcept
+{
+    size_t i = position;
+    const bool is_negated = (i < pattern.length()) && (pattern[i] == '!');
+    if (is_negated) {
+        i++;
+    }
+    bool is_matched = false;
+    // a `]` right after the opening bracket belongs to the set
+    for (const size_t first = i; (i < pattern.length()) && ((pattern[i] != ']') || (i == first)); i++) {
+        if ((i + 2 < pattern.length()) && (pattern[i + 1] == '-') && (pattern[i + 2] != ']')) {
+            is_matched = is_matched || ((pattern[i] <= ch) && (ch <= pattern[i + 2]));
+            i += 2;
+        } else {
+            is_matched = is_matched || (pattern[i] == ch);
+        }
+    }
+    if (i == pattern.length()) {
+        return std::nullopt;
+    }
+    position = i + 1;
+    return is_matched != is_negated;
+}
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace chess {
+
+bool match_glob(std::string_view pattern, std::string_view filename) noexcept
+{
+    size_t p = 0;
+    size_t f = 0;
+    // position after the last `*` and the filename position it is retried from, `*` backtracks to match one more character
+    std::optional<std::pair<size_t, size_t>> star;
+    while (f < filename.length()) {
+        if ((p < pattern.length()) && (pattern[p] == '*')) {
+            star.emplace(++p, f);
+            continue;
+        }
+        if (p < pattern.length()) {
+            size_t next_p = p + 1;
+            bool is_matched = (pattern[p] == '?') || (pattern[p] == filename[f]);
+            if (pattern[p] == '[') {
+                if (const std::optional<bool> is_in_set = match_set(pattern, next_p, filename[f])) {
+                    is_matched = *is_in_set;
+                }
+            }
+            if (is_matched) {
+                p = next_p;
+                f++;
+                continue;
+            }
+        }
+        if (!star) {
+            return false;
+        }
+        p = star->first;
+        f = ++star->second;
+    }
+    while ((p < pattern.length()) && (pattern[p] == '*')) {
+        p++;
+    }
+    return p == pattern.length();
+}
+
+DirectoryFileList::DirectoryFileList(const std::filesystem::path& directory, std::string glob)
+    : glob(std::move(glob))
+{
+    if (!std::filesystem::is_directory(directory)) {
+        throw std::runtime_error("Directory not found: " + directory.string());
+    }
+    it = std::filesystem::recursive_directory_iterator(directory);
+}
+
+std::optional<std::filesystem::path> DirectoryFileList::next()
+{
+    for (; it != std::filesystem::recursive_directory_iterator(); ++it) {
+        if (it->is_regular_file() && match_glob(glob, it->path().filename().string())) {
+            std::filesystem::path result = it->path();
+            ++it;
+            return result;
+        }
+    }
+    return std::nullopt;
+}
+
+PathListReader::PathListReader(std::istream& is) noexcept
+    : is(is)
+{
+}
+
+std::optional<std::filesystem::path> PathListReader::next()
+{
+    std::string entry;
+    while (true) {
+        if (!is_separator_known) {
+            // the first separator tells the format of the whole list
+            for (int ch = is.get(); ch != std::istream::traits_type::eof(); ch = is.get()) {
+                if ((ch == '\n') || (ch == '\0')) {
+                    separator = static_cast<char>(ch);
+                    is_separator_known = true;
+                    break;
+                }
+                entry += static_cast<char>(ch);
+            }
+        } else if (!std::getline(is, entry, separator)) {
+            return std::nullopt;
+        }
+        if ((separator == '\n') && entry.ends_with('\r')) {
+            entry.pop_back();
+        }
+        if (!entry.empty()) {
+            return std::filesystem::path(std::move(entry));
+        }
+        if (!is_separator_known) {
+            // end of a list without separators
+            return std::nullopt;
+        }
+    }
+}
+
+} // namespace chess
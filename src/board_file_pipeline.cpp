@@ -0,0 +1,327 @@
+#include <chess_score_calculator/board_file_pipeline.hpp>
+////////////////////////////////////////////////////////////////////////////////
+// Standard Libraries
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+////////////////////////////////////////////////////////////////////////////////
+// User Defined Libraries
+#include <chess_score_calculator/batch_file_loader.hpp>
+#include <chess_score_calculator/stats.hpp>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+// readers mostly wait on storage, parsers and scorers share the remaining threads
+
+constexpr unsigned get_default_num_read_threads(unsigned num_threads) noexcept
+{
+    return std::max(num_threads / 4, 1U);
+}
+
+constexpr unsigned get_default_num_parse_threads(unsigned num_threads) noexcept
+{
+    return std::max((num_threads - (num_threads / 4)) / 2, 1U);
+}
+
+constexpr unsigned get_default_num_score_threads(unsigned num_threads) noexcept
+{
+    return std::max(num_threads - (num_threads / 4) - ((num_threads - (num_threads / 4)) / 2), 1U);
+}
+
+/// @warning Throws if file cannot be read
+std::string read_file(const std::filesystem::path& file)
+{
+    CHESS_SCORE_CALCULATOR_STATS_TIME(FileOpen);
+    CHESS_SCORE_CALCULATOR_STATS_ADD(Files, 1);
+    std::ifstream ifs(file, std::ios_base::binary | std::ios_base::ate);
+    if (!ifs.is_open()) {
+        throw std::runtime_error("File not found: " + file.string());
+    }
+    // a single read of the whole file, so that slow storage is waited on once
+    std::string result(static_cast<size_t>(ifs.tellg()), '\0');
+    ifs.seekg(0);
+    if (!ifs.read(result.data(), static_cast<std::streamsize>(result.size()))) {
+        throw std::runtime_error("Cannot read file: " + file.string());
+    }
+    return result;
+}
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace chess {
+
+BoardFilePipeline::BoardFilePipeline(std::function<std::optional<std::filesystem::path>()> next_board_path, ResultCache* result_cache, const PipelineOptions& options, unsigned num_threads, ScoreCache* score_cache)
+    : next_board_path(std::move(next_board_path))
+    , result_cache(result_cache)
+    , options(options)
+    , score_cache(score_cache)
+    , num_read_threads(options.num_read_threads ? options.num_read_threads : get_default_num_read_threads(num_threads))
+    , num_parse_threads(options.num_parse_threads ? options.num_parse_threads : get_default_num_parse_threads(num_threads))
+    , num_score_threads(options.num_score_threads ? options.num_score_threads : get_default_num_score_threads(num_threads))
+    // every queue can be full while each reader holds a whole batch
+    , window_size((3 * size_t { options.queue_size }) + (2 * size_t { options.read_batch_size } * num_read_threads))
+    , path_queue(size_t { options.read_batch_size } * num_read_threads)
+    , read_queue(options.queue_size)
+    , parse_queue(options.queue_size)
+    , score_queue(options.queue_size)
+    // a full read queue still leaves each reader a whole batch
+    , buffer_pool(options.queue_size + (size_t { options.read_batch_size } * num_read_threads), file_buffer_size)
+{
+}
+
+std::vector<std::pair<std::string, ResultCacheEntry>> BoardFilePipeline::run(ResultWriter& result_writer)
+{
+    if (options.is_io_uring_requested && !BatchFileLoader(buffer_pool, 1, true).is_using_io_uring()) {
+        std::clog << "io_uring is not available, board files are read synchronously\n";
+    }
+    std::vector<std::thread> threads;
+    start_stage(threads, 1, path_queue, [this] { produce(); });
+    start_stage(threads, num_read_threads, read_queue, [this] { read(); });
+    start_stage(threads, num_parse_threads, parse_queue, [this] { parse(); });
+    start_stage(threads, num_score_threads, score_queue, [this] { score(); });
+    std::vector<std::pair<std::string, ResultCacheEntry>> result;
+    std::exception_ptr exception;
+    try {
+        write(result_writer, result);
+    } catch (...) {
+        exception = std::current_exception();
+    }
+    // an early error stops the producer, the stages drain their queues
+    if (exception) {
+        {
+            const std::lock_guard<std::mutex> lock(window_mutex);
+            is_cancelled.store(true);
+        }
+        window_advanced.notify_all();
+        while (score_queue.pop()) {
+        }
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    if (exception) {
+        std::rethrow_exception(exception);
+    }
+    return result;
+}
+
+template <typename Function>
+void BoardFilePipeline::start_stage(std::vector<std::thread>& threads, unsigned num_stage_threads, BoundedQueue<BoardFileItem>& output_queue, Function function)
+{
+    auto num_running = std::make_shared<std::atomic<unsigned>>(num_stage_threads);
+    for (unsigned i = 0; i < num_stage_threads; i++) {
+        threads.emplace_back([function, num_running, &output_queue] {
+            function();
+            if (num_running->fetch_sub(1) == 1) {
+                output_queue.close();
+            }
+        });
+    }
+}
+
+void BoardFilePipeline::read()
+{
+    BatchFileLoader loader(buffer_pool, options.read_batch_size, options.is_io_uring_requested);
+    std::vector<BoardFileItem> items;
+    std::vector<const std::filesystem::path*> files;
+    std::vector<size_t> file_items;
+    while (!is_cancelled.load()) {
+        items.clear();
+        if (!claim_batch(items)) {
+            break;
+        }
+        files.clear();
+        file_items.clear();
+        for (BoardFileItem& item : items) {
+            if (result_cache && !item.exception) {
+                try {
+                    // the stamp is taken before reading, so a file changed meanwhile is read again at the next run
+                    item.key = ResultCache::get_key(item.board_path);
+                    item.file_stamp = get_file_stamp(item.board_path);
+                    item.cached_entry = result_cache->find(item.key);
+                    if (item.file_stamp && item.cached_entry && (item.cached_entry->file_stamp == *item.file_stamp)) {
+                        item.score = item.cached_entry->score;
+                        num_unchanged++;
+                    }
+                } catch (...) {
+                    item.exception = std::current_exception();
+                }
+            }
+            if (!item.score && !item.exception) {
+                files.push_back(&item.board_path);
+                file_items.push_back(static_cast<size_t>(&item - items.data()));
+            }
+        }
+        // fewer files than given are loaded while the pool runs short of buffers
+        for (size_t i = 0; i < files.size();) {
+            for (const LoadedFile& loaded_file : loader.load(std::span(files).subspan(i))) {
+                take_loaded_file(items[file_items[i++]], loaded_file);
+            }
+        }
+        for (BoardFileItem& item : items) {
+            read_queue.push(std::move(item));
+        }
+    }
+    // a cancelled producer may wait on a full queue, it stops at its next path
+    while (path_queue.pop()) {
+    }
+}
+
+void BoardFilePipeline::produce()
+{
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(window_mutex);
+            window_advanced.wait(lock, [this] { return is_cancelled.load() || (num_board_files < window_begin + window_size); });
+            if (is_cancelled.load()) {
+                return;
+            }
+        }
+        // the source is walked without a lock, so it may block on storage while the readers load their batches
+        BoardFileItem item;
+        try {
+            std::optional<std::filesystem::path> board_path = next_board_path();
+            if (!board_path) {
+                return;
+            }
+            item.board_path = std::move(*board_path);
+        } catch (...) {
+            item.exception = std::current_exception();
+        }
+        item.index = num_board_files++;
+        const bool has_error = static_cast<bool>(item.exception);
+        path_queue.push(std::move(item));
+        if (has_error) {
+            return;
+        }
+    }
+}
+
+bool BoardFilePipeline::claim_batch(std::vector<BoardFileItem>& items)
+{
+    std::optional<BoardFileItem> item = path_queue.pop();
+    while (item) {
+        items.push_back(std::move(*item));
+        if (items.size() == options.read_batch_size) {
+            break;
+        }
+        item = path_queue.try_pop();
+    }
+    return !items.empty();
+}
+
+void BoardFilePipeline::take_loaded_file(BoardFileItem& item, const LoadedFile& loaded_file)
+{
+    const std::filesystem::path& board_path = item.board_path;
+    try {
+        if (loaded_file.open_error != 0) {
+            throw std::runtime_error("File not found: " + board_path.string());
+        }
+        if (loaded_file.read_error != 0) {
+            throw std::runtime_error("Cannot read file: " + board_path.string() + " (" + std::strerror(loaded_file.read_error) + ")");
+        }
+        if (loaded_file.size == buffer_pool.get_buffer_size()) {
+            // the file may be longer than the buffer
+            item.content = read_file(board_path);
+        } else {
+            item.buffer_id = loaded_file.buffer_id;
+            item.content_size = loaded_file.size;
+            return;
+        }
+    } catch (...) {
+        item.exception = std::current_exception();
+    }
+    buffer_pool.release(loaded_file.buffer_id);
+}
+
+void BoardFilePipeline::parse()
+{
+    while (std::optional<BoardFileItem> item = read_queue.pop()) {
+        if (!item->score && !item->exception) {
+            try {
+                const std::string_view content = item->buffer_id ? std::string_view(buffer_pool.get_buffer(*item->buffer_id).data(), item->content_size) : item->content;
+                item->chessboard.emplace(Chessboard::from_string(content, item->board_path));
+                // a touched file may still have the same position
+                if (item->cached_entry && (item->cached_entry->hash == item->chessboard->get_hash())) {
+                    item->score = item->cached_entry->score;
+                }
+            } catch (...) {
+                item->exception = std::current_exception();
+            }
+            if (item->buffer_id) {
+                buffer_pool.release(*item->buffer_id);
+                item->buffer_id.reset();
+            }
+            item->content = std::string();
+        }
+        parse_queue.push(std::move(*item));
+    }
+}
+
+void BoardFilePipeline::score()
+{
+    while (std::optional<BoardFileItem> item = parse_queue.pop()) {
+        if (!item->score && !item->exception) {
+            try {
+                item->score = score_cache ? score_cache->score(*item->chessboard) : item->chessboard->score();
+            } catch (...) {
+                item->exception = std::current_exception();
+            }
+        }
+        score_queue.push(std::move(*item));
+    }
+}
+
+void BoardFilePipeline::write(ResultWriter& result_writer, std::vector<std::pair<std::string, ResultCacheEntry>>& entries)
+{
+    // at most a window of items, since the producer takes no further
+    std::map<size_t, BoardFileItem> early_items;
+    size_t next_row = 0;
+    while (std::optional<BoardFileItem> item = score_queue.pop()) {
+        early_items.emplace(item->index, std::move(*item));
+        const size_t first_row = next_row;
+        for (auto it = early_items.begin(); (it != early_items.end()) && (it->first == next_row); it = early_items.erase(it), next_row++) {
+            BoardFileItem& ready_item = it->second;
+            if (ready_item.exception) {
+                std::rethrow_exception(ready_item.exception);
+            }
+            if (result_cache && ready_item.file_stamp) {
+                const std::uint64_t hash = ready_item.chessboard ? ready_item.chessboard->get_hash() : ready_item.cached_entry->hash;
+                entries.emplace_back(std::move(ready_item.key), ResultCacheEntry { *ready_item.file_stamp, hash, *ready_item.score });
+            }
+            result_writer.write_row(ready_item.board_path.filename().string(), *ready_item.score);
+        }
+        if (next_row != first_row) {
+            advance_window(next_row);
+        }
+    }
+}
+
+void BoardFilePipeline::advance_window(size_t next_row)
+{
+    {
+        const std::lock_guard<std::mutex> lock(window_mutex);
+        window_begin = next_row;
+    }
+    window_advanced.notify_all();
+}
+
+} // namespace chess
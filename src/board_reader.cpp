@@ -0,0 +1,88 @@
+#include <chess_score_calculator/board_reader.hpp>
+////////////////////////////////////////////////////////////////////////////////
+// Standard Libraries
+#include <istream>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+////////////////////////////////////////////////////////////////////////////////
+// User Defined Libraries
+#include <chess_score_calculator/chessboard.hpp>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+/// @returns Line without leading and trailing whitespace
+std::string_view trim(std::string_view line) noexcept
+{
+    constexpr std::string_view whitespace = " \t\r\n\v\f";
+    const size_t begin = line.find_first_not_of(whitespace);
+    if (begin == std::string_view::npos) {
+        return {};
+    }
+    const size_t end = line.find_last_not_of(whitespace);
+    return line.substr(begin, end - begin + 1);
+}
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace chess {
+
+BoardStreamReader::BoardStreamReader(std::istream& input, std::string name)
+    : input(input)
+    , name(std::move(name))
+{
+}
+
+std::optional<BoardRecord> BoardStreamReader::next()
+{
+    constexpr int num_rows = 8;
+    std::optional<std::string> id;
+    size_t first_line_number = 0;
+    int row = 0;
+    board_denotation.clear();
+    while ((row < num_rows) && std::getline(input, line)) {
+        line_number++;
+        const std::string_view content = trim(line);
+        if (content.empty()) {
+            continue;
+        }
+        if (content.front() == '#') {
+            if (row != 0) {
+                throw std::invalid_argument("Incomplete board before line " + std::to_string(line_number) + " at " + name);
+            }
+            id = std::string(trim(content.substr(1)));
+            continue;
+        }
+        if (row == 0) {
+            first_line_number = line_number;
+        }
+        board_denotation.append(content);
+        board_denotation.push_back('\n');
+        row++;
+    }
+    if (row == 0) {
+        if (id) {
+            throw std::invalid_argument("Missing board of ID [" + *id + "] at " + name);
+        }
+        return std::nullopt;
+    }
+    if (row != num_rows) {
+        throw std::invalid_argument("Incomplete board at line " + std::to_string(first_line_number) + " at " + name);
+    }
+    num_boards++;
+    if (!id) {
+        id = name + ":" + std::to_string(num_boards);
+    }
+    try {
+        return BoardRecord { std::move(*id), Chessboard::from_string(board_denotation) };
+    } catch (const std::invalid_argument& e) {
+        throw std::invalid_argument(std::string(e.what()) + " at line " + std::to_string(first_line_number) + " of " + name);
+    }
+}
+
+} // namespace chess
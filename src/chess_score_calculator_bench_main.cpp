@@ -0,0 +1,262 @@
+////////////////////////////////////////////////////////////////////////////////
+// Standard Libraries
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <exception>
+#include <format>
+#include <functional>
+#include <iostream>
+#include <numeric>
+#include <optional>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+////////////////////////////////////////////////////////////////////////////////
+// User Defined Libraries
+#include <chess_score_calculator/board_batch.hpp>
+#include <chess_score_calculator/chessboard.hpp>
+#include <chess_score_calculator/enums.hpp>
+#include <chess_score_calculator/thread_pool.hpp>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+constexpr std::string_view usage = "Usage: chess_score_calculator_bench.exe [--boards N] [--seed N] [--threads N] [--repeat N]\n";
+
+/// Command line options
+struct Options {
+    /// Number of generated boards
+    unsigned num_boards = 100000;
+    unsigned seed = 1;
+    /// Number of threads of the multi-thread runs, 0 means one per hardware thread
+    unsigned num_threads = 0;
+    /// Each stage is run this many times and the fastest run is reported
+    unsigned num_repeats = 3;
+};
+
+/// @warning Throws if value is not a non-negative integer
+unsigned parse_unsigned(std::string_view option, std::string_view value)
+{
+    unsigned result = 0;
+    const auto [ptr, ec] = std::from_chars(value.data(), value.data() + value.size(), result);
+    if ((ec != std::errc {}) || (ptr != value.data() + value.size())) {
+        throw std::invalid_argument("Invalid value [" + std::string(value) + "] for option " + std::string(option));
+    }
+    return result;
+}
+
+/// @warning Throws if value is not a positive integer
+unsigned parse_positive(std::string_view option, std::string_view value)
+{
+    const unsigned result = parse_unsigned(option, value);
+    if (result == 0) {
+        throw std::invalid_argument("Invalid value [" + std::string(value) + "] for option " + std::string(option));
+    }
+    return result;
+}
+
+/// @warning Throws if an option is invalid
+Options parse_options(int argc, char** argv)
+{
+    Options result;
+    for (int i = 1; i < argc; i++) {
+        const std::string_view argument = argv[i];
+        if (i + 1 == argc) {
+            throw std::invalid_argument("Missing value for option " + std::string(argument));
+        }
+        if (argument == "--boards") {
+            result.num_boards = parse_positive(argument, argv[++i]);
+        } else if (argument == "--seed") {
+            result.seed = parse_positive(argument, argv[++i]);
+        } else if (argument == "--threads") {
+            result.num_threads = parse_unsigned(argument, argv[++i]);
+        } else if (argument == "--repeat") {
+            result.num_repeats = parse_positive(argument, argv[++i]);
+        } else {
+            throw std::invalid_argument("Unknown option " + std::string(argument));
+        }
+    }
+    return result;
+}
+
+/**
+Generates board denotations from a seed
+
+Both kings are always present, the number of other pieces is uniform from a full starting set to none,
+so the boards range from openings to sparse endgames. Pawns are never placed at the first or last row.
+*/
+class BoardGenerator {
+public:
+    explicit BoardGenerator(unsigned seed)
+        : random_engine(seed)
+    {
+        constexpr std::array<std::pair<chess::PieceType, int>, 5> starting_set {
+            std::pair { chess::PieceType::Pawn, 8 },
+            std::pair { chess::PieceType::Knight, 2 },
+            std::pair { chess::PieceType::Bishop, 2 },
+            std::pair { chess::PieceType::Rook, 2 },
+            std::pair { chess::PieceType::Queen, 1 },
+        };
+        for (const chess::Side side : { chess::Side::White, chess::Side::Black }) {
+            for (const auto& [piece_type, count] : starting_set) {
+                non_king_pieces.insert(non_king_pieces.end(), count, std::pair { side, piece_type });
+            }
+        }
+    }
+
+    /// @returns Denotation of the next board, same as a board file
+    std::string operator()()
+    {
+        std::array<std::optional<std::pair<chess::Side, chess::PieceType>>, 64> tiles;
+        place(tiles, chess::Side::White, chess::PieceType::King);
+        place(tiles, chess::Side::Black, chess::PieceType::King);
+        std::ranges::shuffle(non_king_pieces, random_engine);
+        const size_t num_pieces = std::uniform_int_distribution<size_t>(0, non_king_pieces.size())(random_engine);
+        for (size_t i = 0; i < num_pieces; i++) {
+            place(tiles, non_king_pieces[i].first, non_king_pieces[i].second);
+        }
+        // rows are written from the 8th to the 1st
+        std::string result;
+        result.reserve(64 * 3);
+        for (int row = 7; row >= 0; row--) {
+            for (int col = 0; col < 8; col++) {
+                const auto& tile = tiles[row * 8 + col];
+                result += tile ? piece_characters[static_cast<size_t>(tile->second)] : '-';
+                result += tile ? side_characters[static_cast<size_t>(tile->first)] : '-';
+                result += (col == 7) ? '\n' : ' ';
+            }
+        }
+        return result;
+    }
+
+private:
+    static constexpr std::string_view piece_characters = "pafkvs";
+    static constexpr std::string_view side_characters = "bs";
+
+    /// Put a piece at a random empty tile that is valid for its type
+    void place(std::array<std::optional<std::pair<chess::Side, chess::PieceType>>, 64>& tiles, chess::Side side, chess::PieceType piece_type)
+    {
+        const bool is_pawn = (piece_type == chess::PieceType::Pawn);
+        std::uniform_int_distribution<int> distribution(is_pawn ? 8 : 0, is_pawn ? 55 : 63);
+        int square = distribution(random_engine);
+        while (tiles[square]) {
+            square = distribution(random_engine);
+        }
+        tiles[square] = std::pair { side, piece_type };
+    }
+
+    std::mt19937_64 random_engine;
+    std::vector<std::pair<chess::Side, chess::PieceType>> non_king_pieces;
+};
+
+/// Writes one row per stage and thread count
+class ReportWriter {
+public:
+    ReportWriter()
+    {
+        std::cout << std::format("| {:<12} | {:>7} | {:>10} | {:>14} |\n", "Stage", "Threads", "ns/board", "boards/sec");
+        std::cout << "| ------------ | ------: | ---------: | -------------: |\n";
+    }
+
+    void write_row(std::string_view stage, unsigned num_threads, size_t num_boards, std::chrono::nanoseconds duration)
+    {
+        const double ns_per_board = static_cast<double>(duration.count()) / static_cast<double>(num_boards);
+        std::cout << std::format("| {:<12} | {:>7} | {:>10.1f} | {:>14.0f} |\n", stage, num_threads, ns_per_board, 1e9 / ns_per_board);
+    }
+};
+
+/// @returns Duration of the fastest run
+std::chrono::nanoseconds measure(unsigned num_repeats, const std::function<void()>& function)
+{
+    std::chrono::nanoseconds result = std::chrono::nanoseconds::max();
+    for (unsigned i = 0; i < num_repeats; i++) {
+        const auto start = std::chrono::steady_clock::now();
+        function();
+        result = std::min(result, std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start));
+    }
+    return result;
+}
+
+/// Run every stage by given thread pool and write their rows
+void run_stages(const std::vector<std::string>& denotations, unsigned num_repeats, chess::ThreadPool& thread_pool, ReportWriter& report_writer)
+{
+    constexpr size_t block_size = 256;
+    const size_t num_boards = denotations.size();
+    const size_t num_blocks = (num_boards + block_size - 1) / block_size;
+    const unsigned num_threads = thread_pool.get_num_threads();
+    std::vector<std::optional<chess::Chessboard>> chessboards(num_boards);
+    // results are kept, so that no stage can be optimized away
+    std::vector<double> checksums(num_boards);
+    // parsing, i.e. the work of the file constructor without the file access
+    report_writer.write_row("parse", num_threads, num_boards, measure(num_repeats, [&] {
+        chess::parallel_for(thread_pool, num_boards, [&](size_t i) {
+            chessboards[i].emplace(chess::Chessboard::from_string(denotations[i]));
+        });
+    }));
+    report_writer.write_row("threats", num_threads, num_boards, measure(num_repeats, [&] {
+        chess::parallel_for(thread_pool, num_boards, [&](size_t i) {
+            const size_t num_threatened_whites = chessboards[i]->get_threatened_white_piece_coordinates().size();
+            const size_t num_threatened_blacks = chessboards[i]->get_threatened_black_piece_coordinates().size();
+            checksums[i] += static_cast<double>(num_threatened_whites + num_threatened_blacks);
+        });
+    }));
+    report_writer.write_row("score", num_threads, num_boards, measure(num_repeats, [&] {
+        chess::parallel_for(thread_pool, num_boards, [&](size_t i) {
+            checksums[i] += chessboards[i]->score_of_whites() + chessboards[i]->score_of_blacks();
+        });
+    }));
+    // batches are built in advance, only the kernel is measured
+    std::vector<chess::BoardBatch> board_batches(num_blocks);
+    for (size_t i = 0; i < num_boards; i++) {
+        board_batches[i / block_size].push_back(*chessboards[i]);
+    }
+    std::vector<chess::Score> scores(num_boards);
+    report_writer.write_row(std::format("batch {}", chess::to_string(chess::get_batch_kernel())), num_threads, num_boards, measure(num_repeats, [&] {
+        chess::parallel_for(thread_pool, num_blocks, [&](size_t block) {
+            const size_t begin = block * block_size;
+            chess::score_batch(board_batches[block], std::span(scores).subspan(begin, board_batches[block].size()));
+        });
+    }));
+    // the kernel is cross-checked against the scalar scoring, so a faster but wrong kernel is not reported
+    for (size_t i = 0; i < num_boards; i++) {
+        const chess::Score expected_score = chessboards[i]->score();
+        if ((scores[i].white != expected_score.white) || (scores[i].black != expected_score.black)) {
+            throw std::runtime_error(std::format("Batch kernel {} differs from Chessboard::score at board {}", chess::to_string(chess::get_batch_kernel()), i));
+        }
+        checksums[i] += scores[i].white + scores[i].black;
+    }
+    std::clog << std::format("Checksum of {} threads: {}\n", num_threads, std::accumulate(checksums.begin(), checksums.end(), 0.0));
+}
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////
+
+int main(int argc, char** argv)
+try {
+    const Options options = parse_options(argc, argv);
+    // generate all boards before any measurement
+    BoardGenerator board_generator(options.seed);
+    std::vector<std::string> denotations(options.num_boards);
+    std::ranges::generate(denotations, std::ref(board_generator));
+    std::clog << std::format("Generated {} boards of seed {}\n", options.num_boards, options.seed);
+    ReportWriter report_writer;
+    chess::ThreadPool single_thread_pool(1);
+    run_stages(denotations, options.num_repeats, single_thread_pool, report_writer);
+    chess::ThreadPool thread_pool(options.num_threads);
+    if (thread_pool.get_num_threads() > 1) {
+        run_stages(denotations, options.num_repeats, thread_pool, report_writer);
+    }
+} catch (const std::exception& e) {
+    std::clog << "Exception: " << e.what() << std::endl;
+    std::clog << usage;
+    return EXIT_FAILURE;
+}
@@ -1,69 +1,817 @@
 ////////////////////////////////////////////////////////////////////////////////
 // Standard Libraries
 #include <algorithm>
+#include <array>
+#include <charconv>
+#include <cstddef>
+#include <csignal>
+#include <cstdint>
 #include <exception>
 #include <filesystem>
 #include <format>
 #include <fstream>
+#include <functional>
 #include <iostream>
 #include <iterator>
+#include <map>
+#include <optional>
 #include <ranges>
-#include <sstream>
+#include <span>
+#include <stdexcept>
 #include <string>
 #include <string_view>
+#include <system_error>
+#include <utility>
 #include <vector>
 ////////////////////////////////////////////////////////////////////////////////
 // User Defined Libraries
+#include <chess_score_calculator/board_batch.hpp>
+#include <chess_score_calculator/board_file_list.hpp>
+#include <chess_score_calculator/board_file_pipeline.hpp>
+#include <chess_score_calculator/board_reader.hpp>
 #include <chess_score_calculator/chessboard.hpp>
+#include <chess_score_calculator/directory_watcher.hpp>
+#include <chess_score_calculator/epd_reader.hpp>
+#include <chess_score_calculator/mapped_file.hpp>
+#include <chess_score_calculator/move_evaluator.hpp>
+#include <chess_score_calculator/move_generator.hpp>
+#include <chess_score_calculator/packed_board.hpp>
+#include <chess_score_calculator/pgn_reader.hpp>
+#include <chess_score_calculator/result_cache.hpp>
+#include <chess_score_calculator/result_writer.hpp>
+#include <chess_score_calculator/score_cache.hpp>
+#include <chess_score_calculator/score_server.hpp>
+#include <chess_score_calculator/stats.hpp>
+#include <chess_score_calculator/thread_pool.hpp>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+constexpr std::string_view usage = "Usage: chess_score_calculator.exe [--threads N] [--cache-size N] [--stats FILE] [output options] [board file options] [--result-cache FILE] [--dir DIR [--glob PATTERN]] [--files-from FILE] board.txt ...\n"
+                                   "       chess_score_calculator.exe [--threads N] [--cache-size N] [--stats FILE] [output options] --container boards.txt\n"
+                                   "       chess_score_calculator.exe [--threads N] [--cache-size N] [--stats FILE] [output options] [--best-moves K] --epd positions.epd\n"
+                                   "       chess_score_calculator.exe [--threads N] [--cache-size N] [--stats FILE] [output options] --packed boards.bin\n"
+                                   "       chess_score_calculator.exe [--threads N] [--cache-size N] [--stats FILE] [output options] --pgn games.pgn\n"
+                                   "       chess_score_calculator.exe [--threads N] [--cache-size N] [--stats FILE] --serve socket_path\n"
+                                   "       chess_score_calculator.exe [--threads N] [--cache-size N] [--stats FILE] --watch directory\n"
+                                   "Output options: [--format table|csv|jsonl] [--column-width N] [--output FILE]\n"
+                                   "Board file options: [--read-threads N] [--parse-threads N] [--score-threads N] [--queue-size N] [--loader sync|io_uring] [--read-batch N]\n";
+
+/// Where and how the results are written
+struct OutputOptions {
+    chess::OutputFormat output_format = chess::OutputFormat::Table;
+    /// Width of the first table column, by default the longest filename if known in advance
+    std::optional<size_t> column_width;
+    /// `-` means stdout only, by default both stdout and result.txt
+    std::optional<std::filesystem::path> output_file;
+};
+
+/// Where board files are listed, they are scored in this order
+struct BoardFileSources {
+    std::vector<std::filesystem::path> board_paths;
+    /// Directory whose files are scored, including the ones of its subdirectories
+    std::optional<std::filesystem::path> directory;
+    /// Pattern the filenames under the directory must match
+    std::optional<std::string> glob;
+    /// File listing board files, `-` means stdin
+    std::optional<std::filesystem::path> path_list_file;
+
+    bool has_any() const noexcept
+    {
+        return !board_paths.empty() || directory || path_list_file;
+    }
+};
+
+/// Command line options
+struct Options {
+    /// Number of boards scored in parallel, 0 means one per hardware thread
+    unsigned num_threads = 0;
+    /// Number of score cache entries, 0 disables the cache, sized to the input if not given
+    std::optional<unsigned> cache_size;
+    /// File of many boards, `-` means stdin
+    std::optional<std::filesystem::path> container_file;
+    /// File of EPD or FEN lines, `-` means stdin
+    std::optional<std::filesystem::path> epd_file;
+    /// Number of moves evaluated per EPD position instead of scoring it, 0 means every move
+    std::optional<unsigned> num_best_moves;
+    /// File of packed boards
+    std::optional<std::filesystem::path> packed_file;
+    /// File of PGN games whose positions are scored after each ply, `-` means stdin
+    std::optional<std::filesystem::path> pgn_file;
+    /// Unix domain socket to serve requests at
+    std::optional<std::filesystem::path> socket_path;
+    /// Directory whose board files are rescored whenever written
+    std::optional<std::filesystem::path> watch_directory;
+    /// Scores of board files persisted between runs
+    std::optional<std::filesystem::path> result_cache_file;
+    /// Report of the performance counters, Prometheus text format if its extension is .prom, JSON otherwise
+    std::optional<std::filesystem::path> stats_file;
+    OutputOptions output;
+    chess::PipelineOptions pipeline;
+    BoardFileSources board_files;
+};
+
+/// @warning Throws if value is not a non-negative integer
+unsigned parse_unsigned(std::string_view option, std::string_view value)
+{
+    unsigned result = 0;
+    const auto [ptr, ec] = std::from_chars(value.data(), value.data() + value.size(), result);
+    if ((ec != std::errc {}) || (ptr != value.data() + value.size())) {
+        throw std::invalid_argument("Invalid value [" + std::string(value) + "] for option " + std::string(option));
+    }
+    return result;
+}
+
+/// @warning Throws if an option is invalid
+Options parse_options(int argc, char** argv)
+{
+    Options result;
+    for (int i = 1; i < argc; i++) {
+        const std::string_view argument = argv[i];
+        const bool is_option = argument.starts_with("--");
+        if (is_option && (i + 1 == argc)) {
+            throw std::invalid_argument("Missing value for option " + std::string(argument));
+        }
+        if (argument == "--threads") {
+            result.num_threads = parse_unsigned(argument, argv[++i]);
+        } else if (argument == "--cache-size") {
+            result.cache_size = parse_unsigned(argument, argv[++i]);
+        } else if (argument == "--container") {
+            result.container_file = argv[++i];
+        } else if (argument == "--epd") {
+            result.epd_file = argv[++i];
+        } else if (argument == "--best-moves") {
+            result.num_best_moves = parse_unsigned(argument, argv[++i]);
+        } else if (argument == "--packed") {
+            result.packed_file = argv[++i];
+        } else if (argument == "--pgn") {
+            result.pgn_file = argv[++i];
+        } else if (argument == "--serve") {
+            result.socket_path = argv[++i];
+        } else if (argument == "--watch") {
+            result.watch_directory = argv[++i];
+        } else if (argument == "--dir") {
+            result.board_files.directory = argv[++i];
+        } else if (argument == "--glob") {
+            result.board_files.glob = argv[++i];
+        } else if (argument == "--files-from") {
+            result.board_files.path_list_file = argv[++i];
+        } else if (argument == "--result-cache") {
+            result.result_cache_file = argv[++i];
+        } else if (argument == "--stats") {
+            result.stats_file = argv[++i];
+        } else if (argument == "--read-threads") {
+            result.pipeline.num_read_threads = parse_unsigned(argument, argv[++i]);
+        } else if (argument == "--parse-threads") {
+            result.pipeline.num_parse_threads = parse_unsigned(argument, argv[++i]);
+        } else if (argument == "--score-threads") {
+            result.pipeline.num_score_threads = parse_unsigned(argument, argv[++i]);
+        } else if (argument == "--queue-size") {
+            result.pipeline.queue_size = parse_unsigned(argument, argv[++i]);
+        } else if (argument == "--loader") {
+            const std::string_view loader = argv[++i];
+            if ((loader != "sync") && (loader != "io_uring")) {
+                throw std::invalid_argument("Invalid value [" + std::string(loader) + "] for option " + std::string(argument));
+            }
+            result.pipeline.is_io_uring_requested = (loader == "io_uring");
+        } else if (argument == "--read-batch") {
+            result.pipeline.read_batch_size = std::max(parse_unsigned(argument, argv[++i]), 1U);
+        } else if (argument == "--format") {
+            result.output.output_format = chess::to_output_format(argv[++i]);
+        } else if (argument == "--column-width") {
+            result.output.column_width = parse_unsigned(argument, argv[++i]);
+        } else if (argument == "--output") {
+            result.output.output_file = argv[++i];
+        } else if (is_option) {
+            throw std::invalid_argument("Unknown option " + std::string(argument));
+        } else {
+            result.board_files.board_paths.emplace_back(argument);
+        }
+    }
+    return result;
+}
+
+/**
+Estimate the number of boards of the input from its size, an overestimate only wastes some cache entries
+
+@returns Number of score cache entries for the input, at most 1048576
+*/
+size_t get_default_cache_size(const Options& options)
+{
+    constexpr size_t max_cache_size = 1 << 20;
+    // the shortest record of each input kind, e.g. `8/8/8/8/8/8/8/8` for EPD and `e4 ` for a PGN ply
+    const auto get_max_num_boards = [](const std::filesystem::path& file, size_t min_record_size) {
+        std::error_code error_code;
+        const std::uintmax_t file_size = std::filesystem::file_size(file, error_code);
+        // stdin has no size
+        return ((file == "-") || error_code) ? max_cache_size : static_cast<size_t>(file_size / min_record_size + 1);
+    };
+    size_t result = max_cache_size;
+    if (options.container_file) {
+        result = get_max_num_boards(*options.container_file, 8 * 17);
+    } else if (options.epd_file) {
+        result = get_max_num_boards(*options.epd_file, 16);
+    } else if (options.packed_file) {
+        result = get_max_num_boards(*options.packed_file, 32);
+    } else if (options.pgn_file) {
+        result = get_max_num_boards(*options.pgn_file, 3);
+    } else if (!options.board_files.directory && !options.board_files.path_list_file && !options.socket_path && !options.watch_directory) {
+        result = options.board_files.board_paths.size();
+    }
+    return std::min(result, max_cache_size);
+}
+
+/// State shared by the scoring functions
+struct ScoringContext {
+    chess::ThreadPool& thread_pool;
+    /// Scores of already seen positions, nullptr if disabled
+    chess::ScoreCache* score_cache;
+};
+
+/// @returns Writer of the results as given by the options
+chess::ResultWriter make_result_writer(const OutputOptions& output, size_t default_column_width)
+{
+    return chess::ResultWriter(output.output_format, output.column_width.value_or(default_column_width), output.output_file.value_or("result.txt"), !output.output_file);
+}
+
+/// @returns Writer of the results with a score change column, see #make_result_writer
+chess::ResultWriter make_result_writer_with_delta(const OutputOptions& output, size_t default_column_width)
+{
+    return chess::ResultWriter(output.output_format, output.column_width.value_or(default_column_width), output.output_file.value_or("result.txt"), !output.output_file, true);
+}
+
+/// Score a board by the score cache if enabled
+chess::Score score_chessboard(const chess::Chessboard& chessboard, const ScoringContext& context)
+{
+    return context.score_cache ? context.score_cache->score(chessboard) : chessboard.score();
+}
+
+/**
+Score board files by the pipeline and write the rows in input order
+
+The directory and the path list are enumerated as the pipeline takes their files, so scoring starts
+before they are fully listed, and no command line limit applies to their number.
+@param result_cache_file Scores of the previous run, unchanged files are neither read nor scored
+@warning Throws if the directory or the path list is not found
+*/
+void score_board_files(const BoardFileSources& board_files, const std::optional<std::filesystem::path>& result_cache_file, const OutputOptions& output, const chess::PipelineOptions& pipeline_options, const ScoringContext& context)
+{
+    std::optional<chess::ResultCache> result_cache;
+    if (result_cache_file) {
+        result_cache.emplace(*result_cache_file);
+    }
+    std::optional<chess::DirectoryFileList> directory_file_list;
+    if (board_files.directory) {
+        directory_file_list.emplace(*board_files.directory, board_files.glob.value_or("*"));
+    }
+    std::ifstream path_list_ifs;
+    std::optional<chess::PathListReader> path_list_reader;
+    if (board_files.path_list_file == "-") {
+        path_list_reader.emplace(std::cin);
+    } else if (board_files.path_list_file) {
+        path_list_ifs.open(*board_files.path_list_file, std::ios_base::binary);
+        if (!path_list_ifs.is_open()) {
+            throw std::runtime_error("File not found: " + board_files.path_list_file->string());
+        }
+        path_list_reader.emplace(path_list_ifs);
+    }
+    size_t next_argument = 0;
+    const auto next_board_path = [&]() -> std::optional<std::filesystem::path> {
+        if (next_argument < board_files.board_paths.size()) {
+            return board_files.board_paths[next_argument++];
+        }
+        if (directory_file_list) {
+            if (std::optional<std::filesystem::path> board_path = directory_file_list->next()) {
+                return board_path;
+            }
+        }
+        return path_list_reader ? path_list_reader->next() : std::nullopt;
+    };
+    // filenames of the command line are known in advance, so the first column fits them without keeping the rows
+    size_t filename_column_width = chess::filename_header.length();
+    for (const std::filesystem::path& board_path : board_files.board_paths) {
+        filename_column_width = std::max(filename_column_width, board_path.filename().native().length());
+    }
+    chess::ResultWriter result_writer = make_result_writer(output, filename_column_width);
+    chess::BoardFilePipeline pipeline(next_board_path, result_cache ? &*result_cache : nullptr, pipeline_options, context.thread_pool.get_num_threads(), context.score_cache);
+    std::vector<std::pair<std::string, chess::ResultCacheEntry>> entries = pipeline.run(result_writer);
+    result_writer.close();
+    if (result_cache) {
+        // readers look the cache up until the pipeline finishes, so it is updated afterwards
+        for (auto& [key, entry] : entries) {
+            result_cache->insert(std::move(key), entry);
+        }
+        result_cache->save();
+        std::clog << std::format("Result cache: {} of {} board files unchanged\n", pipeline.get_num_unchanged(), pipeline.get_num_board_files());
+    }
+}
+
+/// Score boards by the batch kernel, except the ones whose score is cached
+void score_block(std::span<const chess::BoardRecord> records, std::span<chess::Score> scores, chess::ScoreCache* score_cache)
+{
+    chess::BoardBatch board_batch;
+    board_batch.reserve(records.size());
+    std::vector<size_t> batch_indices;
+    batch_indices.reserve(records.size());
+    for (size_t i = 0; i < records.size(); i++) {
+        if (score_cache) {
+            if (const std::optional<chess::Score> cached_score = score_cache->find(records[i].chessboard.get_hash())) {
+                scores[i] = *cached_score;
+                continue;
+            }
+        }
+        board_batch.push_back(records[i].chessboard);
+        batch_indices.push_back(i);
+    }
+    std::vector<chess::Score> batch_scores(board_batch.size());
+    chess::score_batch(board_batch, batch_scores);
+    for (size_t j = 0; j < batch_indices.size(); j++) {
+        scores[batch_indices[j]] = batch_scores[j];
+        if (score_cache) {
+            score_cache->insert(records[batch_indices[j]].chessboard.get_hash(), batch_scores[j]);
+        }
+    }
+}
+
+/**
+Score a stream of boards chunk by chunk, writing each chunk before reading the next one
+
+@param next_record Returns the next board, or empty at the end of the stream
+*/
+void score_stream(const std::function<std::optional<chess::BoardRecord>()>& next_record, const OutputOptions& output, const ScoringContext& context)
+{
+    // IDs are unknown in advance, so the first column keeps the width of its header by default
+    chess::ResultWriter result_writer = make_result_writer(output, chess::filename_header.length());
+    constexpr size_t block_size = 256;
+    const size_t chunk_size = static_cast<size_t>(context.thread_pool.get_num_threads()) * block_size;
+    std::vector<chess::BoardRecord> records;
+    records.reserve(chunk_size);
+    std::vector<chess::Score> scores(chunk_size);
+    bool end_of_stream = false;
+    while (!end_of_stream) {
+        records.clear();
+        while (records.size() < chunk_size) {
+            std::optional<chess::BoardRecord> record = next_record();
+            if (!record) {
+                end_of_stream = true;
+                break;
+            }
+            records.push_back(std::move(*record));
+        }
+        // each task scores a block of boards by the batch kernel
+        const size_t num_blocks = (records.size() + block_size - 1) / block_size;
+        chess::parallel_for(context.thread_pool, num_blocks, [&](size_t block) {
+            const size_t begin = block * block_size;
+            const size_t count = std::min(block_size, records.size() - begin);
+            score_block(std::span(records).subspan(begin, count), std::span(scores).subspan(begin, count), context.score_cache);
+        });
+        for (size_t i = 0; i < records.size(); i++) {
+            result_writer.write_row(records[i].id, scores[i]);
+        }
+        // a slow input, e.g. a pipe, still gets its rows chunk by chunk
+        result_writer.flush();
+    }
+    result_writer.close();
+}
+
+/// Score the boards of a container file, `-` means stdin
+void score_container(const std::filesystem::path& container_file, const OutputOptions& output, const ScoringContext& context)
+{
+    const bool is_stdin = (container_file == "-");
+    std::ifstream ifs;
+    if (!is_stdin) {
+        ifs.open(container_file);
+        if (!ifs.is_open()) {
+            throw std::runtime_error("File not found: " + container_file.string());
+        }
+    }
+    chess::BoardStreamReader reader(is_stdin ? std::cin : ifs, is_stdin ? "stdin" : container_file.filename().string());
+    score_stream([&reader] { return reader.next(); }, output, context);
+}
+
+/// Content of an input file that is parsed in place
+struct Input {
+    std::optional<chess::MappedFile> mapped_file;
+    std::string content;
+    /// Prefix of the generated IDs
+    std::string name;
+
+    std::string_view get_view() const noexcept { return mapped_file ? mapped_file->get_view() : std::string_view(content); }
+};
+
+/**
+Map a file, or read stdin at once since it cannot be mapped
+
+@param path `-` means stdin
+@warning Throws if the file cannot be mapped
+*/
+Input load_input(const std::filesystem::path& path)
+{
+    Input result;
+    if (path == "-") {
+        result.content.assign(std::istreambuf_iterator<char>(std::cin), std::istreambuf_iterator<char>());
+        result.name = "stdin";
+    } else {
+        result.mapped_file.emplace(path);
+        result.name = path.filename().string();
+    }
+    return result;
+}
+
+/// Score the positions of an EPD file, `-` means stdin
+void score_epd(const std::filesystem::path& epd_file, const OutputOptions& output, const ScoringContext& context)
+{
+    const Input input = load_input(epd_file);
+    chess::EpdReader reader(input.get_view());
+    score_stream([&]() -> std::optional<chess::BoardRecord> {
+        std::optional<chess::EpdRecord> record = reader.next();
+        if (!record) {
+            return std::nullopt;
+        }
+        std::string id = record->id.empty() ? input.name + ":" + std::to_string(record->line_number) : std::string(record->id);
+        return chess::BoardRecord { std::move(id), record->chessboard };
+    },
+        output, context);
+}
+
+/**
+Evaluate the pseudo-legal moves of the side to move at each position of an EPD file, `-` means stdin
+
+The moves of a chunk of positions are evaluated in parallel, each on a copy of its position. The
+best moves of each position are written by decreasing delta with IDs `<position id>:<move>`.
+@param num_moves Number of moves written per position, 0 means every move
+*/
+void evaluate_epd_moves(const std::filesystem::path& epd_file, size_t num_moves, const OutputOptions& output, const ScoringContext& context)
+{
+    const Input input = load_input(epd_file);
+    chess::EpdReader reader(input.get_view());
+    chess::ResultWriter result_writer = make_result_writer_with_delta(output, chess::filename_header.length());
+    /// A position whose moves are being evaluated
+    struct Position {
+        std::string id;
+        chess::Chessboard chessboard;
+        chess::Side side;
+        chess::Score score;
+        /// Evaluations of this position are in [begin, end) of all evaluations of the chunk
+        size_t begin;
+        size_t end;
+    };
+    constexpr size_t positions_per_thread = 16;
+    const size_t chunk_size = static_cast<size_t>(context.thread_pool.get_num_threads()) * positions_per_thread;
+    std::vector<Position> positions;
+    positions.reserve(chunk_size);
+    std::vector<std::pair<size_t, chess::Move>> moves;
+    std::vector<chess::MoveEvaluation> evaluations;
+    bool end_of_file = false;
+    while (!end_of_file) {
+        positions.clear();
+        moves.clear();
+        while (positions.size() < chunk_size) {
+            std::optional<chess::EpdRecord> record = reader.next();
+            if (!record) {
+                end_of_file = true;
+                break;
+            }
+            std::string id = record->id.empty() ? input.name + ":" + std::to_string(record->line_number) : std::string(record->id);
+            // the attacks are generated once per position, each copy only updates the pieces its move affects
+            record->chessboard.build_attack_cache();
+            const chess::Score score = score_chessboard(record->chessboard, context);
+            Position& position = positions.emplace_back(Position { std::move(id), record->chessboard, record->side_to_move, score, moves.size(), 0 });
+            for (const chess::Move& move : chess::generate_moves(position.chessboard, position.side)) {
+                moves.emplace_back(positions.size() - 1, move);
+            }
+            position.end = moves.size();
+        }
+        // moves of every position are spread across the pool, so a position with many moves does not wait on a single thread
+        evaluations.resize(moves.size());
+        chess::parallel_for(context.thread_pool, moves.size(), [&](size_t i) {
+            const Position& position = positions[moves[i].first];
+            evaluations[i] = chess::evaluate_move(position.chessboard, position.score, position.side, moves[i].second);
+        });
+        for (const Position& position : positions) {
+            std::vector<chess::MoveEvaluation> position_evaluations(evaluations.begin() + static_cast<std::ptrdiff_t>(position.begin), evaluations.begin() + static_cast<std::ptrdiff_t>(position.end));
+            chess::select_top_moves(position_evaluations, num_moves);
+            for (const chess::MoveEvaluation& evaluation : position_evaluations) {
+                result_writer.write_row(position.id + ":" + chess::to_string(evaluation.move), evaluation.score, evaluation.delta);
+            }
+        }
+        result_writer.flush();
+    }
+    result_writer.close();
+}
+
+/// Score the records of a packed board file
+void score_packed(const std::filesystem::path& packed_file, const OutputOptions& output, const ScoringContext& context)
+{
+    const chess::PackedBoardFile packed_boards(packed_file);
+    const std::string name = packed_file.filename().string();
+    size_t index = 0;
+    score_stream([&]() -> std::optional<chess::BoardRecord> {
+        if (index == packed_boards.size()) {
+            return std::nullopt;
+        }
+        const chess::PackedBoard packed_board = packed_boards[index++];
+        return chess::BoardRecord { name + ":" + std::to_string(index), chess::Chessboard::from_packed(packed_board) };
+    },
+        output, context);
+}
+
+/**
+Score the position after each ply of the games of a PGN file, `-` means stdin
+
+Games are replayed in parallel, each on a single board that is updated move by move. The row of
+ply 0 is the initial position, so a game of n plies gets n + 1 rows with IDs `<name>:<game>:<ply>`.
+A game with an invalid move or FEN tag gets no rows and is reported to stderr.
+*/
+void score_pgn(const std::filesystem::path& pgn_file, const OutputOptions& output, const ScoringContext& context)
+{
+    const Input input = load_input(pgn_file);
+    chess::PgnReader reader(input.get_view());
+    chess::ResultWriter result_writer = make_result_writer(output, chess::filename_header.length());
+    // a game is a task, since its plies depend on each other
+    constexpr size_t games_per_thread = 16;
+    const size_t chunk_size = static_cast<size_t>(context.thread_pool.get_num_threads()) * games_per_thread;
+    std::vector<chess::PgnGame> games;
+    games.reserve(chunk_size);
+    std::vector<std::vector<chess::Score>> game_scores(chunk_size);
+    std::vector<std::string> game_errors(chunk_size);
+    bool end_of_file = false;
+    while (!end_of_file) {
+        games.clear();
+        while (games.size() < chunk_size) {
+            std::optional<chess::PgnGame> game = reader.next();
+            if (!game) {
+                end_of_file = true;
+                break;
+            }
+            games.push_back(std::move(*game));
+        }
+        chess::parallel_for(context.thread_pool, games.size(), [&](size_t i) {
+            std::vector<chess::Score>& scores = game_scores[i];
+            scores.clear();
+            game_errors[i].clear();
+            // a malformed game must not stop scoring the others
+            try {
+                chess::GameReplay replay(games[i]);
+                scores.push_back(score_chessboard(replay.get_chessboard(), context));
+                while (replay.play_next_move()) {
+                    scores.push_back(score_chessboard(replay.get_chessboard(), context));
+                }
+            } catch (const std::exception& e) {
+                scores.clear();
+                game_errors[i] = e.what();
+            }
+        });
+        for (size_t i = 0; i < games.size(); i++) {
+            if (!game_errors[i].empty()) {
+                std::clog << std::format("Skipped {}:{}: {}\n", input.name, games[i].game_number, game_errors[i]);
+                continue;
+            }
+            const std::string prefix = input.name + ":" + std::to_string(games[i].game_number) + ":";
+            for (size_t ply = 0; ply < game_scores[i].size(); ply++) {
+                result_writer.write_row(prefix + std::to_string(ply), game_scores[i][ply]);
+            }
+        }
+        result_writer.flush();
+    }
+    result_writer.close();
+}
+
+/// Write the performance counters of the run, which are only counted if stats are enabled
+void write_stats(const std::filesystem::path& stats_file)
+{
+#ifdef CHESS_SCORE_CALCULATOR_ENABLE_STATS
+    std::ofstream ofs(stats_file);
+    if (!ofs.is_open()) {
+        throw std::runtime_error("Cannot write " + stats_file.string());
+    }
+    const chess::stats::Snapshot snapshot = chess::stats::get_snapshot();
+    if (stats_file.extension() == ".prom") {
+        chess::stats::write_prometheus(ofs, snapshot);
+    } else {
+        chess::stats::write_json(ofs, snapshot);
+    }
+#else
+    static_cast<void>(stats_file);
+#endif
+}
+
+/// Server or watcher to stop at SIGINT or SIGTERM
+chess::ScoreServer* running_server = nullptr;
+chess::DirectoryWatcher* running_watcher = nullptr;
+
+extern "C" void stop_running_mode(int)
+{
+    if (running_server) {
+        running_server->stop();
+    }
+    if (running_watcher) {
+        running_watcher->stop();
+    }
+}
+
+/// Serve requests until SIGINT or SIGTERM
+void serve(const std::filesystem::path& socket_path, const ScoringContext& context)
+{
+    chess::ScoreServer score_server(socket_path, context.thread_pool, context.score_cache);
+    running_server = &score_server;
+    std::signal(SIGINT, stop_running_mode);
+    std::signal(SIGTERM, stop_running_mode);
+    std::clog << "Serving at " << socket_path.string() << '\n';
+    score_server.run();
+    std::signal(SIGINT, SIG_DFL);
+    std::signal(SIGTERM, SIG_DFL);
+    running_server = nullptr;
+}
+
+/**
+Score the changed board files in parallel
+
+@returns Score of each change, empty if the file is removed or cannot be scored
+*/
+std::vector<std::optional<chess::Score>> score_changes(const std::vector<chess::FileChange>& changes, const ScoringContext& context)
+{
+    std::vector<std::optional<chess::Score>> result(changes.size());
+    std::vector<std::string> errors(changes.size());
+    chess::parallel_for(context.thread_pool, changes.size(), [&](size_t i) {
+        if (changes[i].is_removed) {
+            return;
+        }
+        // a broken file must not stop watching the others
+        try {
+            result[i] = score_chessboard(chess::Chessboard(changes[i].file), context);
+        } catch (const std::exception& e) {
+            errors[i] = e.what();
+        }
+    });
+    for (size_t i = 0; i < changes.size(); i++) {
+        if (!errors[i].empty()) {
+            std::clog << std::format("Skipped {}: {}\n", changes[i].file.string(), errors[i]);
+        }
+    }
+    return result;
+}
+
+/// Files of the watch mode table in the working directory
+const std::filesystem::path watch_result_file = "result.txt";
+const std::filesystem::path watch_temporary_file = "result.txt.tmp";
+
+/// Replace result.txt by the table of given scores, so that readers never see a partial table
+void write_result_file(const std::map<std::string, chess::Score>& scores)
+{
+    size_t filename_column_width = chess::filename_header.length();
+    for (const auto& [filename, score] : scores) {
+        filename_column_width = std::max(filename_column_width, filename.length());
+    }
+    {
+        chess::ResultWriter result_writer(chess::OutputFormat::Table, filename_column_width, watch_temporary_file, false);
+        for (const auto& [filename, score] : scores) {
+            result_writer.write_row(filename, score);
+        }
+        // a truncated table must not replace the previous one
+        result_writer.close();
+    }
+    std::filesystem::rename(watch_temporary_file, watch_result_file);
+}
+
+/**
+Score every board file under a directory, then rescore the written files until SIGINT or SIGTERM
+
+The first column is the path relative to the directory. The full table is written to stdout once, then a table of
+the rescored files for each batch of changes, removed files are reported to stderr. result.txt always holds the full table.
+*/
+void watch(const std::filesystem::path& directory, const ScoringContext& context)
+{
+    // the watches are added before the first scan, so that no file written meanwhile is missed
+    chess::DirectoryWatcher directory_watcher(directory);
+    running_watcher = &directory_watcher;
+    std::signal(SIGINT, stop_running_mode);
+    std::signal(SIGTERM, stop_running_mode);
+    // result.txt is under the directory if it is the working directory or one of its parents, and rescoring
+    // it as a board file would rewrite it, which is reported as another change
+    const std::array<std::filesystem::path, 2> output_files { std::filesystem::weakly_canonical(watch_result_file), std::filesystem::weakly_canonical(watch_temporary_file) };
+    const auto is_output_file = [&output_files](const chess::FileChange& change) {
+        if ((change.file.filename() != watch_result_file) && (change.file.filename() != watch_temporary_file)) {
+            return false;
+        }
+        std::error_code ec;
+        return std::ranges::find(output_files, std::filesystem::weakly_canonical(change.file, ec)) != output_files.end();
+    };
+    std::vector<chess::FileChange> changes;
+    for (std::filesystem::path& file : chess::get_regular_files(directory)) {
+        changes.push_back(chess::FileChange { std::move(file), false });
+    }
+    std::map<std::string, chess::Score> scores;
+    bool is_first_scan = true;
+    while (is_first_scan || !changes.empty()) {
+        std::erase_if(changes, is_output_file);
+        const std::vector<std::optional<chess::Score>> changed_scores = score_changes(changes, context);
+        // the map keeps the rows sorted by path
+        std::map<std::string, chess::Score> changed_rows;
+        bool is_table_changed = false;
+        for (size_t i = 0; i < changes.size(); i++) {
+            std::string filename = changes[i].file.lexically_relative(directory).generic_string();
+            if (changes[i].is_directory) {
+                // every row under the directory, or every row if the watched directory is listed from scratch
+                const std::string prefix = (filename == ".") ? "" : filename + "/";
+                for (auto it = scores.lower_bound(prefix); (it != scores.end()) && it->first.starts_with(prefix);) {
+                    if (filename != ".") {
+                        std::clog << "Removed " << it->first << '\n';
+                    }
+                    it = scores.erase(it);
+                    is_table_changed = true;
+                }
+            } else if (changed_scores[i]) {
+                const auto [it, is_inserted] = scores.try_emplace(filename, *changed_scores[i]);
+                if (is_inserted || (it->second.white != changed_scores[i]->white) || (it->second.black != changed_scores[i]->black)) {
+                    it->second = *changed_scores[i];
+                    is_table_changed = true;
+                }
+                changed_rows.insert_or_assign(std::move(filename), *changed_scores[i]);
+            } else if (scores.erase(filename) != 0) {
+                std::clog << "Removed " << filename << '\n';
+                is_table_changed = true;
+            }
+        }
+        if (is_first_scan || !changed_rows.empty()) {
+            size_t filename_column_width = chess::filename_header.length();
+            for (const auto& [filename, score] : changed_rows) {
+                filename_column_width = std::max(filename_column_width, filename.length());
+            }
+            chess::ResultWriter result_writer(chess::OutputFormat::Table, filename_column_width, "-", false);
+            for (const auto& [filename, score] : changed_rows) {
+                result_writer.write_row(filename, score);
+            }
+        }
+        // an unchanged table is not rewritten, as the rewrite is a change of result.txt for any other watcher
+        if (is_first_scan || is_table_changed) {
+            write_result_file(scores);
+        }
+        is_first_scan = false;
+        changes = directory_watcher.wait_changes();
+    }
+    std::signal(SIGINT, SIG_DFL);
+    std::signal(SIGTERM, SIG_DFL);
+    running_watcher = nullptr;
+}
+
+} // namespace
+
 ////////////////////////////////////////////////////////////////////////////////
 
 int main(int argc, char** argv)
 try {
-    // check argument provided
-    if (argc == 1) {
-        std::clog << "Usage: chess_score_calculator.exe board.txt ...\n";
+    // parse options and check exactly one input kind is provided
+    const Options options = parse_options(argc, argv);
+    const int num_inputs = options.board_files.has_any() + options.container_file.has_value() + options.epd_file.has_value() + options.packed_file.has_value() + options.pgn_file.has_value() + options.socket_path.has_value() + options.watch_directory.has_value();
+    if (num_inputs != 1) {
+        std::clog << usage;
         return 1;
     }
-    // obtain input file paths
-    const int num_boards = argc - 1;
-    std::vector<std::filesystem::path> board_paths(num_boards);
-    for (int i = 1; i < argc; i++) {
-        board_paths.at(i - 1) = argv[i];
-    }
-    // calculate scores
-    std::vector<double> white_scores;
-    white_scores.reserve(num_boards);
-    std::vector<double> black_scores;
-    black_scores.reserve(num_boards);
-    for (int i = 0; i < num_boards; i++) {
-        chess::Chessboard chessboard(board_paths.at(i));
-        const double score_of_whites = chessboard.score_of_whites();
-        const double score_of_blacks = chessboard.score_of_blacks();
-        white_scores.push_back(score_of_whites);
-        black_scores.push_back(score_of_blacks);
-    }
-    // create output file
-    // keep only filename parts
-    std::vector<std::string> filenames;
-    filenames.reserve(num_boards);
-    std::ranges::transform(board_paths, std::back_inserter(filenames), [](const std::filesystem::path& board_path) { return board_path.filename().string(); });
-    // calculate width of first column
-    constexpr std::string_view filename_header = "Chessboard filename";
-    size_t filename_column_width = filename_header.length();
-    for (const std::string& filename : filenames) {
-        filename_column_width = std::max(filename_column_width, filename.length());
+    if (options.board_files.glob && !options.board_files.directory) {
+        throw std::invalid_argument("Option --glob only applies to --dir");
+    }
+    if (options.num_best_moves && !options.epd_file) {
+        throw std::invalid_argument("Option --best-moves only applies to --epd");
+    }
+    if (options.result_cache_file && !options.board_files.has_any()) {
+        throw std::invalid_argument("Option --result-cache only applies to board files");
+    }
+    if ((options.socket_path || options.watch_directory) && (options.output.column_width || options.output.output_file || (options.output.output_format != chess::OutputFormat::Table))) {
+        throw std::invalid_argument("Options --format, --column-width and --output do not apply to --serve and --watch");
+    }
+    if (options.stats_file && !chess::stats::is_enabled) {
+        throw std::invalid_argument("Option --stats requires a build with CHESS_SCORE_CALCULATOR_ENABLE_STATS");
+    }
+    chess::ThreadPool thread_pool(options.num_threads);
+    std::optional<chess::ScoreCache> score_cache;
+    if (const size_t cache_size = options.cache_size.value_or(get_default_cache_size(options)); cache_size != 0) {
+        score_cache.emplace(cache_size);
+    }
+    const ScoringContext context { thread_pool, score_cache ? &*score_cache : nullptr };
+    if (options.container_file) {
+        score_container(*options.container_file, options.output, context);
+    } else if (options.epd_file && options.num_best_moves) {
+        evaluate_epd_moves(*options.epd_file, *options.num_best_moves, options.output, context);
+    } else if (options.epd_file) {
+        score_epd(*options.epd_file, options.output, context);
+    } else if (options.packed_file) {
+        score_packed(*options.packed_file, options.output, context);
+    } else if (options.pgn_file) {
+        score_pgn(*options.pgn_file, options.output, context);
+    } else if (options.socket_path) {
+        serve(*options.socket_path, context);
+    } else if (options.watch_directory) {
+        watch(*options.watch_directory, context);
+    } else {
+        score_board_files(options.board_files, options.result_cache_file, options.output, options.pipeline, context);
+    }
+    if (options.stats_file) {
+        if (score_cache) {
+            std::clog << std::format("Score cache: {} hits, {} misses\n", score_cache->get_num_hits(), score_cache->get_num_misses());
+        }
+        write_stats(*options.stats_file);
     }
-    // write out in table format
-    std::ostringstream oss;
-    std::format_to(std::ostream_iterator<char>(oss), "| {:{}} | White | Black |\n", filename_header, filename_column_width);
-    oss << "| " << std::string(filename_column_width, '-') << " | ----- | ----- |\n";
-    for (int i = 0; i < num_boards; i++) {
-        std::format_to(std::ostream_iterator<char>(oss), "| {:{}} | {:<5} | {:<5} |\n", filenames.at(i), filename_column_width, white_scores.at(i), black_scores.at(i));
-    }
-    // print to both file and stdout
-    std::cout << oss.str();
-    std::ofstream ofs("result.txt");
-    ofs << oss.rdbuf();
 } catch (const std::exception& e) {
     std::clog << "Exception: " << e.what() << std::endl;
 }
@@ -0,0 +1,42 @@
+////////////////////////////////////////////////////////////////////////////////
+// Standard Libraries
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string_view>
+////////////////////////////////////////////////////////////////////////////////
+// User Defined Libraries
+#include <chess_score_calculator/chessboard.hpp>
+#include <chess_score_calculator/packed_board.hpp>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+constexpr std::string_view usage = "Usage: chess_score_calculator_pack.exe boards.bin board.txt ...\n";
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////
+
+int main(int argc, char** argv)
+try {
+    // check arguments provided
+    if (argc < 3) {
+        std::clog << usage;
+        return 1;
+    }
+    // open output file by exceptions enabled
+    std::ofstream ofs;
+    ofs.exceptions(std::ios_base::badbit | std::ios_base::failbit);
+    ofs.open(argv[1], std::ios_base::binary);
+    // append one record per board at argument order
+    for (int i = 2; i < argc; i++) {
+        const chess::Chessboard chessboard { std::filesystem::path(argv[i]) };
+        const chess::PackedBoard packed_board = chess::pack(chessboard);
+        ofs.write(reinterpret_cast<const char*>(packed_board.nibbles.data()), packed_board.nibbles.size());
+    }
+    std::clog << "Packed " << (argc - 2) << " boards into " << argv[1] << '\n';
+} catch (const std::exception& e) {
+    std::clog << "Exception: " << e.what() << std::endl;
+}
@@ -1,19 +1,28 @@
 #include <chess_score_calculator/chessboard.hpp>
 ////////////////////////////////////////////////////////////////////////////////
 // Standard Libraries
-#include <execution>
+#include <bit>
 #include <filesystem>
-#include <fstream>
-#include <iterator>
-#include <memory>
-#include <numeric>
-#include <ranges>
+#include <optional>
+#include <span>
 #include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
 #include <vector>
 ////////////////////////////////////////////////////////////////////////////////
 // User Defined Libraries
+#include <chess_score_calculator/attack_tables.hpp>
+#include <chess_score_calculator/bitboard.hpp>
+#include <chess_score_calculator/coordinate_set.hpp>
 #include <chess_score_calculator/enums.hpp>
+#include <chess_score_calculator/mapped_file.hpp>
+#include <chess_score_calculator/packed_board.hpp>
 #include <chess_score_calculator/piece.hpp>
+#include <chess_score_calculator/sliding_attacks.hpp>
+#include <chess_score_calculator/stats.hpp>
+#include <chess_score_calculator/tile.hpp>
+#include <chess_score_calculator/zobrist.hpp>
 ////////////////////////////////////////////////////////////////////////////////
 
 namespace {
@@ -21,17 +30,52 @@ namespace {
 /// Function object to throw invalid_argument at Chessboard constructor
 class ThrowInvalidArgument {
 public:
-    explicit ThrowInvalidArgument(const std::filesystem::path& board_file) noexcept
+    /// @param board_file Source of the denotation, nullptr if parsed from memory
+    explicit ThrowInvalidArgument(const std::filesystem::path* board_file) noexcept
         : board_file(board_file)
     {
     }
 
-    [[noreturn]] void operator()(std::string description, std::string denotation) const
+    [[noreturn]] void operator()(std::string description, std::string_view denotation) const
     {
-        throw std::invalid_argument(description + " [" + denotation + "] at file " + board_file.filename().string());
+        std::string message = description + " [" + std::string(denotation) + "]";
+        if (board_file) {
+            message += " at file " + board_file->filename().string();
+        }
+        throw std::invalid_argument(message);
     }
 
-    const std::filesystem::path& board_file;
+    const std::filesystem::path* board_file;
+};
+
+/// Function object to split denotation into whitespace separated tokens without copying
+class GetToken {
+public:
+    explicit GetToken(std::string_view denotation) noexcept
+        : denotation(denotation)
+    {
+    }
+
+    /// @returns Next token, empty if end of denotation is reached
+    std::string_view operator()() noexcept
+    {
+        while ((position < denotation.size()) && is_whitespace(denotation[position])) {
+            position++;
+        }
+        const size_t start = position;
+        while ((position < denotation.size()) && !is_whitespace(denotation[position])) {
+            position++;
+        }
+        return denotation.substr(start, position - start);
+    }
+
+    static constexpr bool is_whitespace(char ch) noexcept
+    {
+        return (ch == ' ') || (ch == '\n') || (ch == '\r') || (ch == '\t') || (ch == '\v') || (ch == '\f');
+    }
+
+    std::string_view denotation;
+    size_t position = 0;
 };
 
 /// Function object to convert denotation to Side or throw invalid argument
@@ -59,62 +103,79 @@ public:
     const ThrowInvalidArgument& throw_invalid_argument;
 };
 
-/// Function object to convert denotation to Piece or throw invalid argument
-class GetPiece {
+/// Function object to convert denotation to PieceType or throw invalid argument
+class GetPieceType {
 public:
-    using Chessboard = chess::Chessboard;
-    using Piece = chess::Piece;
-    using Coordinate = chess::Coordinate;
-    using Side = chess::Side;
+    using PieceType = chess::PieceType;
 
-    explicit GetPiece(const Chessboard& chessboard, const ThrowInvalidArgument& throw_invalid_argument) noexcept
-        : chessboard(chessboard)
-        , throw_invalid_argument(throw_invalid_argument)
+    explicit GetPieceType(const ThrowInvalidArgument& throw_invalid_argument) noexcept
+        : throw_invalid_argument(throw_invalid_argument)
     {
     }
 
-    std::unique_ptr<Piece> operator()(char ch, const Coordinate& coordinate, Side side) const
+    PieceType operator()(char ch) const
     {
-        using namespace chess;
         switch (ch) {
         case 'p':
-            return std::make_unique<Pawn>(coordinate, side, chessboard);
+            return PieceType::Pawn;
         case 'a':
-            return std::make_unique<Knight>(coordinate, side, chessboard);
+            return PieceType::Knight;
         case 'f':
-            return std::make_unique<Bishop>(coordinate, side, chessboard);
+            return PieceType::Bishop;
         case 'k':
-            return std::make_unique<Rook>(coordinate, side, chessboard);
+            return PieceType::Rook;
         case 'v':
-            return std::make_unique<Queen>(coordinate, side, chessboard);
+            return PieceType::Queen;
         case 's':
-            return std::make_unique<King>(coordinate, side, chessboard);
+            return PieceType::King;
         default:
             throw_invalid_argument("Invalid piece denotation character", std::string { ch });
         }
     }
 
-    const Chessboard& chessboard;
     const ThrowInvalidArgument& throw_invalid_argument;
 };
 
-/// Function object to get the score of a Piece at given Coordinate
-class GetScore {
+/// Function object to convert FEN piece letter to PieceType and Side or throw invalid argument
+class GetFenPiece {
 public:
-    using Chessboard = chess::Chessboard;
-    using Coordinate = chess::Coordinate;
+    using PieceType = chess::PieceType;
+    using Side = chess::Side;
 
-    explicit GetScore(const Chessboard& chessboard) noexcept
-        : chessboard(chessboard)
+    explicit GetFenPiece(const ThrowInvalidArgument& throw_invalid_argument) noexcept
+        : throw_invalid_argument(throw_invalid_argument)
     {
     }
 
-    double operator()(const Coordinate& coordinate) const
+    /// Uppercase letters are whites, lowercase letters are blacks
+    std::pair<PieceType, Side> operator()(char ch) const
     {
-        return chessboard.get_tile_at(coordinate).get_piece().get_unthreatened_score();
+        const Side side = ((ch >= 'A') && (ch <= 'Z')) ? Side::White : Side::Black;
+        switch (ch) {
+        case 'P':
+        case 'p':
+            return { PieceType::Pawn, side };
+        case 'N':
+        case 'n':
+            return { PieceType::Knight, side };
+        case 'B':
+        case 'b':
+            return { PieceType::Bishop, side };
+        case 'R':
+        case 'r':
+            return { PieceType::Rook, side };
+        case 'Q':
+        case 'q':
+            return { PieceType::Queen, side };
+        case 'K':
+        case 'k':
+            return { PieceType::King, side };
+        default:
+            throw_invalid_argument("Invalid FEN piece character", std::string_view(&ch, 1));
+        }
     }
 
-    const Chessboard& chessboard;
+    const ThrowInvalidArgument& throw_invalid_argument;
 };
 
 } // namespace
@@ -125,18 +186,234 @@ namespace chess {
 
 Chessboard::Chessboard(const std::filesystem::path& board_file)
 {
-    // check if file exists
-    if (!std::filesystem::is_regular_file(board_file)) {
-        throw std::runtime_error("File not found: " + board_file.string());
+    // map the file and parse it in place
+    const MappedFile mapped_file(board_file);
+    parse(mapped_file.get_view(), &board_file);
+}
+
+Chessboard Chessboard::from_string(std::string_view board_denotation)
+{
+    Chessboard result;
+    result.parse(board_denotation, nullptr);
+    return result;
+}
+
+Chessboard Chessboard::from_string(std::string_view board_denotation, const std::filesystem::path& board_file)
+{
+    Chessboard result;
+    result.parse(board_denotation, &board_file);
+    return result;
+}
+
+Chessboard Chessboard::from_buffer(std::span<const char> board_denotation)
+{
+    return from_string(std::string_view(board_denotation.data(), board_denotation.size()));
+}
+
+Chessboard Chessboard::from_fen(std::string_view fen)
+{
+    // piece placement is the first field
+    const size_t end = fen.find_first_of(" \t\r\n");
+    Chessboard result;
+    result.parse_fen(fen.substr(0, end));
+    return result;
+}
+
+Chessboard Chessboard::from_packed(const PackedBoard& packed_board)
+{
+    Chessboard result;
+    for (int square = 0; square < 64; square++) {
+        const int nibble = (packed_board.nibbles[square / 2] >> (4 * (square % 2))) & 0xF;
+        if (nibble == 0) {
+            continue;
+        }
+        const int type = (nibble & 7) - 1;
+        if ((type < static_cast<int>(PieceType::Pawn)) || (type > static_cast<int>(PieceType::King))) {
+            throw std::invalid_argument("Invalid packed tile [" + std::to_string(nibble) + "]");
+        }
+        const Side side = (nibble & 8) ? Side::Black : Side::White;
+        result.put_piece(to_coordinate(square), static_cast<PieceType>(type), side);
+    }
+    CHESS_SCORE_CALCULATOR_STATS_ADD(Boards, 1);
+    CHESS_SCORE_CALCULATOR_STATS_ADD(Pieces, std::popcount(result.get_bitboard()));
+    return result;
+}
+
+Tile Chessboard::get_tile_at(const Coordinate& coordinate) const
+{
+    if (!is_valid_coordinate(coordinate)) {
+        throw std::invalid_argument("Provided coordinate is not valid");
+    }
+    const std::optional<PieceType> piece_type = get_piece_type_at(coordinate);
+    if (!piece_type) {
+        return Tile(coordinate);
+    }
+    const Side side = (get_bitboard(Side::White) & to_bitboard(coordinate)) ? Side::White : Side::Black;
+    return Tile(Piece(*piece_type, coordinate, side));
+}
+
+std::optional<PieceType> Chessboard::get_piece_type_at(const Coordinate& coordinate) const noexcept
+{
+    const Bitboard target = to_bitboard(coordinate);
+    for (size_t i = 0; i < piece_type_bitboards.size(); i++) {
+        if (piece_type_bitboards[i] & target) {
+            return static_cast<PieceType>(i);
+        }
+    }
+    return std::nullopt;
+}
+
+Bitboard Chessboard::get_bitboard(Side side) const noexcept
+{
+    return side_bitboards[static_cast<size_t>(side)];
+}
+
+Bitboard Chessboard::get_bitboard(PieceType piece_type) const noexcept
+{
+    return piece_type_bitboards[static_cast<size_t>(piece_type)];
+}
+
+Bitboard Chessboard::get_bitboard() const noexcept
+{
+    return get_bitboard(Side::White) | get_bitboard(Side::Black);
+}
+
+CoordinateSet Chessboard::get_white_piece_coordinates() const
+{
+    return CoordinateSet(get_bitboard(Side::White));
+}
+
+CoordinateSet Chessboard::get_black_piece_coordinates() const
+{
+    return CoordinateSet(get_bitboard(Side::Black));
+}
+
+CoordinateSet Chessboard::get_all_piece_coordinates() const
+{
+    return CoordinateSet(get_bitboard());
+}
+
+Bitboard Chessboard::get_threatened_bitboard(Side side) const
+{
+    const Side opponent = get_opposite_side(side);
+    if (has_attack_cache) {
+        const Bitboard result = side_attacks[static_cast<size_t>(opponent)] & get_bitboard(side);
+        CHESS_SCORE_CALCULATOR_STATS_ADD(Threats, std::popcount(result));
+        return result;
+    }
+    const Bitboard opponent_pieces = get_bitboard(opponent);
+    Bitboard attacks = 0;
+    // leapers only depend on their own tile, the scopes only delimit the timed phases
+    {
+        CHESS_SCORE_CALCULATOR_STATS_TIME(PawnThreats);
+        for (Bitboard pawns = opponent_pieces & get_bitboard(PieceType::Pawn); pawns;) {
+            attacks |= get_pawn_attacks(opponent, pop_square(pawns));
+        }
+    }
+    {
+        CHESS_SCORE_CALCULATOR_STATS_TIME(KnightThreats);
+        for (Bitboard knights = opponent_pieces & get_bitboard(PieceType::Knight); knights;) {
+            attacks |= get_knight_attacks(pop_square(knights));
+        }
+    }
+    {
+        CHESS_SCORE_CALCULATOR_STATS_TIME(KingThreats);
+        for (Bitboard kings = opponent_pieces & get_bitboard(PieceType::King); kings;) {
+            attacks |= get_king_attacks(pop_square(kings));
+        }
+    }
+    // sliders depend on the blocking pieces, queens move as both bishops and rooks
+    const Bitboard occupancy = get_bitboard();
+    {
+        CHESS_SCORE_CALCULATOR_STATS_TIME(BishopThreats);
+        for (Bitboard bishops = opponent_pieces & get_bitboard(PieceType::Bishop); bishops;) {
+            attacks |= get_bishop_attacks(pop_square(bishops), occupancy);
+        }
+    }
+    {
+        CHESS_SCORE_CALCULATOR_STATS_TIME(RookThreats);
+        for (Bitboard rooks = opponent_pieces & get_bitboard(PieceType::Rook); rooks;) {
+            attacks |= get_rook_attacks(pop_square(rooks), occupancy);
+        }
+    }
+    {
+        CHESS_SCORE_CALCULATOR_STATS_TIME(QueenThreats);
+        for (Bitboard queens = opponent_pieces & get_bitboard(PieceType::Queen); queens;) {
+            const int square = pop_square(queens);
+            attacks |= get_bishop_attacks(square, occupancy) | get_rook_attacks(square, occupancy);
+        }
+    }
+    const Bitboard result = attacks & get_bitboard(side);
+    CHESS_SCORE_CALCULATOR_STATS_ADD(Threats, std::popcount(result));
+    return result;
+}
+
+std::uint64_t Chessboard::get_hash() const noexcept
+{
+    return hash;
+}
+
+CoordinateSet Chessboard::get_threatened_white_piece_coordinates() const
+{
+    return CoordinateSet(get_threatened_bitboard(Side::White));
+}
+
+CoordinateSet Chessboard::get_threatened_black_piece_coordinates() const
+{
+    return CoordinateSet(get_threatened_bitboard(Side::Black));
+}
+
+CoordinateSet Chessboard::get_unthreatened_white_piece_coordinates() const
+{
+    return CoordinateSet(get_bitboard(Side::White) & ~get_threatened_bitboard(Side::White));
+}
+
+CoordinateSet Chessboard::get_unthreatened_black_piece_coordinates() const
+{
+    return CoordinateSet(get_bitboard(Side::Black) & ~get_threatened_bitboard(Side::Black));
+}
+
+double Chessboard::score_of_whites() const
+{
+    return score_of(Side::White, get_threatened_bitboard(Side::White));
+}
+
+double Chessboard::score_of_blacks() const
+{
+    return score_of(Side::Black, get_threatened_bitboard(Side::Black));
+}
+
+Score Chessboard::score() const
+{
+    // each threat map is generated once and shared by both sides' sums
+    const Bitboard threatened_whites = get_threatened_bitboard(Side::White);
+    const Bitboard threatened_blacks = get_threatened_bitboard(Side::Black);
+    return Score { score_of(Side::White, threatened_whites), score_of(Side::Black, threatened_blacks) };
+}
+
+double Chessboard::score_of(Side side, Bitboard threatened) const noexcept
+{
+    CHESS_SCORE_CALCULATOR_STATS_TIME(Reduction);
+    const Bitboard pieces = get_bitboard(side);
+    double result = 0;
+    for (size_t i = 0; i < piece_type_bitboards.size(); i++) {
+        const Bitboard pieces_of_type = pieces & piece_type_bitboards[i];
+        const int num_unthreatened = std::popcount(pieces_of_type & ~threatened);
+        const int num_threatened = std::popcount(pieces_of_type & threatened);
+        // threatened pieces count as half
+        result += get_piece_score(static_cast<PieceType>(i)) * (num_unthreatened + num_threatened / 2.0);
     }
-    // open file by exceptions enabled
-    std::ifstream ifs;
-    ifs.exceptions(std::ios_base::badbit | std::ios_base::failbit);
-    ifs.open(board_file);
+    return result;
+}
+
+void Chessboard::parse(std::string_view board_denotation, const std::filesystem::path* board_file)
+{
+    CHESS_SCORE_CALCULATOR_STATS_TIME(Tokenize);
     // create function object instances
     const ThrowInvalidArgument throw_invalid_argument(board_file);
     const GetSide get_side(throw_invalid_argument);
-    const GetPiece get_piece(*this, throw_invalid_argument);
+    const GetPieceType get_piece_type(throw_invalid_argument);
+    GetToken get_token(board_denotation);
     // perform int - Coordinate conversions
     constexpr int row_start = static_cast<int>(Row::_1);
     constexpr int row_end = static_cast<int>(Row::_8);
@@ -146,158 +423,228 @@ Chessboard::Chessboard(const std::filesystem::path& board_file)
     for (int row = row_end; row >= row_start; row--) {
         for (int col = col_start; col <= col_end; col++) {
             // get denotation of tile
-            std::string tile_denotation;
-            ifs >> tile_denotation;
+            const std::string_view tile_denotation = get_token();
+            if (tile_denotation.empty()) {
+                throw_invalid_argument("Unexpected end of board denotation", tile_denotation);
+            }
             // denotation must consist of 2 characters
             if (tile_denotation.length() != 2) {
                 throw_invalid_argument("Invalid tile denotation", tile_denotation);
             }
-            // current coordinate point
-            const Coordinate coordinate { static_cast<Row>(row), static_cast<Column>(col) };
-            // current index
-            const int row_index = row - row_start;
-            const int col_index = col - col_start;
             // check empty tile
             if (tile_denotation == "--") {
-                tiles.at(row_index).at(col_index) = Tile(coordinate);
                 continue;
             }
+            CHESS_SCORE_CALCULATOR_STATS_TIME(PieceConstruction);
+            // current coordinate point
+            const Coordinate coordinate { static_cast<Row>(row), static_cast<Column>(col) };
             // get side from second denotation character
             const Side side = get_side(tile_denotation[1]);
-            // get piece from first denotation character
-            std::unique_ptr<Piece> piece = get_piece(tile_denotation[0], coordinate, side);
-            // assign to tile
-            tiles.at(row_index).at(col_index) = Tile(std::move(piece));
+            // get piece type from first denotation character
+            const PieceType piece_type = get_piece_type(tile_denotation[0]);
+            // mark the tile as occupied
+            put_piece(coordinate, piece_type, side);
         }
     }
+    CHESS_SCORE_CALCULATOR_STATS_ADD(Boards, 1);
+    CHESS_SCORE_CALCULATOR_STATS_ADD(Pieces, std::popcount(get_bitboard()));
 }
 
-Tile& Chessboard::get_tile_at(const Coordinate& coordinate) &
+void Chessboard::parse_fen(std::string_view piece_placement)
 {
-    if (!is_valid_coordinate(coordinate)) {
-        throw std::invalid_argument("Provided coordinate is not valid");
+    CHESS_SCORE_CALCULATOR_STATS_TIME(Tokenize);
+    // create function object instances
+    const ThrowInvalidArgument throw_invalid_argument(nullptr);
+    const GetFenPiece get_fen_piece(throw_invalid_argument);
+    // ranks are given from 8 to 1, files from a to h
+    int row = static_cast<int>(Row::_8);
+    int col = static_cast<int>(Column::a);
+    constexpr int num_cols = 8;
+    for (char ch : piece_placement) {
+        if (ch == '/') {
+            if ((col != num_cols) || (row == static_cast<int>(Row::_1))) {
+                throw_invalid_argument("Invalid FEN rank", piece_placement);
+            }
+            row--;
+            col = static_cast<int>(Column::a);
+        } else if ((ch >= '1') && (ch <= '8')) {
+            col += ch - '0';
+        } else {
+            CHESS_SCORE_CALCULATOR_STATS_TIME(PieceConstruction);
+            const auto [piece_type, side] = get_fen_piece(ch);
+            if (col >= num_cols) {
+                throw_invalid_argument("Invalid FEN rank", piece_placement);
+            }
+            put_piece(Coordinate { static_cast<Row>(row), static_cast<Column>(col) }, piece_type, side);
+            col++;
+        }
+        if (col > num_cols) {
+            throw_invalid_argument("Invalid FEN rank", piece_placement);
+        }
     }
-    constexpr int row_start = static_cast<int>(Row::_1);
-    constexpr int col_start = static_cast<int>(Column::a);
-    const int row_index = static_cast<int>(coordinate.row) - row_start;
-    const int col_index = static_cast<int>(coordinate.col) - col_start;
-    return tiles.at(row_index).at(col_index);
+    if ((row != static_cast<int>(Row::_1)) || (col != num_cols)) {
+        throw_invalid_argument("Incomplete FEN piece placement", piece_placement);
+    }
+    CHESS_SCORE_CALCULATOR_STATS_ADD(Boards, 1);
+    CHESS_SCORE_CALCULATOR_STATS_ADD(Pieces, std::popcount(get_bitboard()));
 }
 
-const Tile& Chessboard::get_tile_at(const Coordinate& coordinate) const&
+void Chessboard::make_move(const Coordinate& from, const Coordinate& to)
 {
-    return const_cast<Chessboard*>(this)->get_tile_at(coordinate);
+    make_move(Move { from, to, std::nullopt, false, false });
 }
 
-std::set<Coordinate> Chessboard::get_white_piece_coordinates() const
+void Chessboard::make_move(const Move& move)
 {
-    std::set<Coordinate> result;
-    for (const std::array<Tile, 8>& row : tiles) {
-        for (const Tile& tile : row) {
-            if (tile.has_piece() && (tile.get_piece().get_side() == Side::White)) {
-                result.emplace(tile.get_coordinate());
-            }
+    if (!is_valid_coordinate(move.from) || !is_valid_coordinate(move.to)) {
+        throw std::invalid_argument("Provided coordinate is not valid");
+    }
+    const std::optional<PieceType> piece_type = get_piece_type_at(move.from);
+    if (!piece_type) {
+        throw std::invalid_argument("No piece to move");
+    }
+    const Side side = (get_bitboard(Side::White) & to_bitboard(move.from)) ? Side::White : Side::Black;
+    const Side opponent = get_opposite_side(side);
+    if (get_bitboard(side) & to_bitboard(move.to)) {
+        throw std::invalid_argument("Cannot capture a piece of the same side");
+    }
+    MoveRecord move_record { to_square(move.from), to_square(move.to), *piece_type, get_piece_type_at(move.to), to_square(move.to), move.promotion, 0, 0 };
+    if (move.promotion && ((*piece_type != PieceType::Pawn) || (*move.promotion == PieceType::Pawn) || (*move.promotion == PieceType::King))) {
+        throw std::invalid_argument("Invalid promotion");
+    }
+    if (move.is_en_passant) {
+        // the captured pawn is beside the moving pawn, in the column of the target tile
+        move_record.captured_square = to_square(Coordinate { move.from.row, move.to.col });
+        if ((*piece_type != PieceType::Pawn) || move_record.captured_piece_type || !(get_bitboard(opponent) & get_bitboard(PieceType::Pawn) & (Bitboard { 1 } << move_record.captured_square))) {
+            throw std::invalid_argument("Invalid en passant capture");
         }
+        move_record.captured_piece_type = PieceType::Pawn;
     }
-    return result;
-}
-
-std::set<Coordinate> Chessboard::get_black_piece_coordinates() const
-{
-    std::set<Coordinate> result;
-    for (const std::array<Tile, 8>& row : tiles) {
-        for (const Tile& tile : row) {
-            if (tile.has_piece() && (tile.get_piece().get_side() == Side::Black)) {
-                result.emplace(tile.get_coordinate());
-            }
+    move_record.rook_from = move_record.rook_to = move_record.from;
+    if (move.is_castling) {
+        // the rook of the side the king moves towards jumps over the king
+        const bool is_kingside = move.to.col > move.from.col;
+        move_record.rook_from = to_square(Coordinate { move.from.row, is_kingside ? Column::h : Column::a });
+        move_record.rook_to = (move_record.from + move_record.to) / 2;
+        const bool is_rook_at_corner = (get_bitboard(side) & get_bitboard(PieceType::Rook) & (Bitboard { 1 } << move_record.rook_from)) != 0;
+        const bool is_rook_target_empty = !(get_bitboard() & (Bitboard { 1 } << move_record.rook_to));
+        if ((*piece_type != PieceType::King) || move_record.captured_piece_type || !is_rook_at_corner || !is_rook_target_empty) {
+            throw std::invalid_argument("Invalid castling");
         }
     }
-    return result;
+    if (!has_attack_cache) {
+        build_attack_cache();
+    }
+    // sliders that see any changed tile before the move are the only ones whose rays can change
+    const Bitboard changed = (Bitboard { 1 } << move_record.from) | (Bitboard { 1 } << move_record.to) | (Bitboard { 1 } << move_record.captured_square)
+        | (Bitboard { 1 } << move_record.rook_from) | (Bitboard { 1 } << move_record.rook_to);
+    const Bitboard affected_sliders = get_sliders_attacking(changed) & ~changed;
+    // update occupancy
+    if (move_record.captured_piece_type) {
+        remove_piece(move_record.captured_square, *move_record.captured_piece_type, opponent);
+        piece_attacks[move_record.captured_square] = 0;
+    }
+    remove_piece(move_record.from, *piece_type, side);
+    put_piece(move.to, move.promotion.value_or(*piece_type), side);
+    piece_attacks[move_record.from] = 0;
+    if (move.is_castling) {
+        remove_piece(move_record.rook_from, PieceType::Rook, side);
+        put_piece(to_coordinate(move_record.rook_to), PieceType::Rook, side);
+        piece_attacks[move_record.rook_from] = 0;
+    }
+    update_attack_cache(affected_sliders | (get_bitboard(side) & changed));
+    move_history.push_back(move_record);
 }
 
-std::set<Coordinate> Chessboard::get_all_piece_coordinates() const
+void Chessboard::unmake_move()
 {
-    std::set<Coordinate> result = get_white_piece_coordinates();
-    result.merge(get_black_piece_coordinates());
-    return result;
+    if (move_history.empty()) {
+        throw std::logic_error("No move to revert");
+    }
+    const MoveRecord move_record = move_history.back();
+    move_history.pop_back();
+    const Coordinate from = to_coordinate(move_record.from);
+    const Coordinate to = to_coordinate(move_record.to);
+    const Side side = (get_bitboard(Side::White) & to_bitboard(to)) ? Side::White : Side::Black;
+    // sliders that see any changed tile before reverting are the only ones whose rays can change
+    const Bitboard changed = (Bitboard { 1 } << move_record.from) | (Bitboard { 1 } << move_record.to) | (Bitboard { 1 } << move_record.captured_square)
+        | (Bitboard { 1 } << move_record.rook_from) | (Bitboard { 1 } << move_record.rook_to);
+    const Bitboard affected_sliders = get_sliders_attacking(changed) & ~changed;
+    // restore occupancy
+    if (move_record.rook_from != move_record.rook_to) {
+        remove_piece(move_record.rook_to, PieceType::Rook, side);
+        put_piece(to_coordinate(move_record.rook_from), PieceType::Rook, side);
+        piece_attacks[move_record.rook_to] = 0;
+    }
+    remove_piece(move_record.to, move_record.promotion.value_or(move_record.piece_type), side);
+    put_piece(from, move_record.piece_type, side);
+    piece_attacks[move_record.to] = 0;
+    if (move_record.captured_piece_type) {
+        put_piece(to_coordinate(move_record.captured_square), *move_record.captured_piece_type, get_opposite_side(side));
+    }
+    update_attack_cache(affected_sliders | changed);
 }
 
-std::set<Coordinate> Chessboard::get_threatened_white_piece_coordinates() const
+void Chessboard::put_piece(const Coordinate& coordinate, PieceType piece_type, Side side) noexcept
 {
-    std::set<Coordinate> result;
-    for (Coordinate black_coordinate : get_black_piece_coordinates()) {
-        const Piece& black_piece = get_tile_at(black_coordinate).get_piece();
-        result.merge(black_piece.get_threated_piece_coordinates());
-    }
-    return result;
+    const Bitboard target = to_bitboard(coordinate);
+    side_bitboards[static_cast<size_t>(side)] |= target;
+    piece_type_bitboards[static_cast<size_t>(piece_type)] |= target;
+    hash ^= get_zobrist_key(side, piece_type, to_square(coordinate));
 }
 
-std::set<Coordinate> Chessboard::get_threatened_black_piece_coordinates() const
+void Chessboard::remove_piece(int square, PieceType piece_type, Side side) noexcept
 {
-    std::set<Coordinate> result;
-    for (Coordinate white_coordinate : get_white_piece_coordinates()) {
-        const Piece& white_piece = get_tile_at(white_coordinate).get_piece();
-        result.merge(white_piece.get_threated_piece_coordinates());
-    }
-    return result;
+    const Bitboard target = Bitboard { 1 } << square;
+    side_bitboards[static_cast<size_t>(side)] &= ~target;
+    piece_type_bitboards[static_cast<size_t>(piece_type)] &= ~target;
+    hash ^= get_zobrist_key(side, piece_type, square);
 }
 
-std::set<Coordinate> Chessboard::get_unthreatened_white_piece_coordinates() const
+Bitboard Chessboard::get_attacks_of(int square, PieceType piece_type, Side side) const noexcept
 {
-    const std::set<Coordinate> all = get_white_piece_coordinates();
-    const std::set<Coordinate> threatened = get_threatened_white_piece_coordinates();
-    std::set<Coordinate> result;
-    std::ranges::set_difference(all, threatened, std::inserter(result, result.begin()));
-    return result;
+    return get_piece_attacks(piece_type, square, side, get_bitboard());
 }
 
-std::set<Coordinate> Chessboard::get_unthreatened_black_piece_coordinates() const
+Bitboard Chessboard::get_sliders_attacking(Bitboard targets) const noexcept
 {
-    const std::set<Coordinate> all = get_black_piece_coordinates();
-    const std::set<Coordinate> threatened = get_threatened_black_piece_coordinates();
-    std::set<Coordinate> result;
-    std::ranges::set_difference(all, threatened, std::inserter(result, result.begin()));
+    // a slider sees a tile if a slider of the same kind at that tile sees the slider
+    const Bitboard occupancy = get_bitboard();
+    const Bitboard queens = get_bitboard(PieceType::Queen);
+    const Bitboard diagonal_sliders = get_bitboard(PieceType::Bishop) | queens;
+    const Bitboard straight_sliders = get_bitboard(PieceType::Rook) | queens;
+    Bitboard result = 0;
+    while (targets) {
+        const int square = pop_square(targets);
+        result |= get_bishop_attacks(square, occupancy) & diagonal_sliders;
+        result |= get_rook_attacks(square, occupancy) & straight_sliders;
+    }
     return result;
 }
 
-double Chessboard::score_of_whites() const
+void Chessboard::build_attack_cache() noexcept
 {
-    // create function object instance
-    const GetScore get_score(*this);
-    // get white coordinates
-    const std::set<Coordinate> unthreatened_coordinates = get_unthreatened_white_piece_coordinates();
-    const std::set<Coordinate> threatened_coordinates = get_threatened_white_piece_coordinates();
-    // calculate unthreatened score
-    std::vector<double> unthreatened_scores;
-    unthreatened_scores.reserve(unthreatened_coordinates.size());
-    std::ranges::transform(unthreatened_coordinates, std::back_inserter(unthreatened_scores), get_score);
-    const double unthreatened_score = std::reduce(std::execution::par_unseq, unthreatened_scores.begin(), unthreatened_scores.end());
-    // calculate threatened score
-    std::vector<double> threatened_scores;
-    threatened_scores.reserve(threatened_coordinates.size());
-    std::ranges::transform(threatened_coordinates, std::back_inserter(threatened_scores), get_score);
-    const double threatened_score = std::reduce(std::execution::par_unseq, threatened_scores.begin(), threatened_scores.end()) / 2.0;
-    return unthreatened_score + threatened_score;
+    piece_attacks.fill(0);
+    has_attack_cache = true;
+    update_attack_cache(get_bitboard());
 }
 
-double Chessboard::score_of_blacks() const
+void Chessboard::update_attack_cache(Bitboard pieces) noexcept
 {
-    // create function object instance
-    const GetScore get_score(*this);
-    // get black coordinates
-    const std::set<Coordinate> unthreatened_coordinates = get_unthreatened_black_piece_coordinates();
-    const std::set<Coordinate> threatened_coordinates = get_threatened_black_piece_coordinates();
-    // calculate unthreatened score
-    std::vector<double> unthreatened_scores;
-    unthreatened_scores.reserve(unthreatened_coordinates.size());
-    std::ranges::transform(unthreatened_coordinates, std::back_inserter(unthreatened_scores), get_score);
-    const double unthreatened_score = std::reduce(std::execution::par_unseq, unthreatened_scores.begin(), unthreatened_scores.end());
-    // calculate threatened score
-    std::vector<double> threatened_scores;
-    threatened_scores.reserve(threatened_coordinates.size());
-    std::ranges::transform(threatened_coordinates, std::back_inserter(threatened_scores), get_score);
-    const double threatened_score = std::reduce(std::execution::par_unseq, threatened_scores.begin(), threatened_scores.end()) / 2.0;
-    return unthreatened_score + threatened_score;
+    for (size_t type = 0; type < piece_type_bitboards.size(); type++) {
+        for (Bitboard pieces_of_type = pieces & piece_type_bitboards[type]; pieces_of_type;) {
+            const int square = pop_square(pieces_of_type);
+            const Side side = (get_bitboard(Side::White) >> square & 1) ? Side::White : Side::Black;
+            piece_attacks[square] = get_attacks_of(square, static_cast<PieceType>(type), side);
+        }
+    }
+    // a side has few pieces, so the unions are cheaper to rebuild than to maintain per piece
+    for (size_t side = 0; side < side_bitboards.size(); side++) {
+        side_attacks[side] = 0;
+        for (Bitboard side_pieces = side_bitboards[side]; side_pieces;) {
+            side_attacks[side] |= piece_attacks[pop_square(side_pieces)];
+        }
+    }
 }
 
 } // namespace chess
@@ -0,0 +1,258 @@
+#include <chess_score_calculator/directory_watcher.hpp>
+////////////////////////////////////////////////////////////////////////////////
+// Standard Libraries
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+#ifdef __linux__
+#define CHESS_SCORE_CALCULATOR_HAS_INOTIFY
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+[[noreturn]] void throw_system_error(const std::string& what)
+{
+    throw std::system_error(errno, std::generic_category(), what);
+}
+
+/// Keep only the last change of each file, in order of their last change
+void remove_superseded_changes(std::vector<chess::FileChange>& changes)
+{
+    std::unordered_set<std::string> files;
+    std::vector<chess::FileChange> result;
+    for (auto it = changes.rbegin(); it != changes.rend(); ++it) {
+        if (files.insert(it->file.native()).second) {
+            result.push_back(std::move(*it));
+        }
+    }
+    std::ranges::reverse(result);
+    changes = std::move(result);
+}
+
+/// @returns Whether the error means that the directory was removed or replaced before it is iterated
+bool is_vanished(const std::error_code& error_code) noexcept
+{
+    return (error_code == std::errc::no_such_file_or_directory) || (error_code == std::errc::not_a_directory);
+}
+
+/**
+Call function with each entry of a directory, nothing if the directory is removed meanwhile
+
+@warning Throws if the directory cannot be iterated for another reason
+*/
+template <typename Function>
+void for_each_entry(const std::filesystem::path& directory, Function function)
+{
+    std::error_code error_code;
+    std::filesystem::directory_iterator it(directory, error_code);
+    for (; !error_code && (it != std::filesystem::directory_iterator()); it.increment(error_code)) {
+        function(*it);
+    }
+    if (error_code && !is_vanished(error_code)) {
+        throw std::filesystem::filesystem_error("Cannot iterate directory", directory, error_code);
+    }
+}
+
+/// Append the regular files under a directory, skipping the subdirectories removed meanwhile
+void append_regular_files(const std::filesystem::path& directory, std::vector<std::filesystem::path>& files)
+{
+    for_each_entry(directory, [&files](const std::filesystem::directory_entry& entry) {
+        std::error_code error_code;
+        if (entry.is_symlink(error_code)) {
+            if (entry.is_regular_file(error_code)) {
+                files.push_back(entry.path());
+            }
+        } else if (entry.is_directory(error_code)) {
+            append_regular_files(entry.path(), files);
+        } else if (entry.is_regular_file(error_code)) {
+            files.push_back(entry.path());
+        }
+    });
+}
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace chess {
+
+std::vector<std::filesystem::path> get_regular_files(const std::filesystem::path& directory)
+{
+    if (!std::filesystem::is_directory(directory)) {
+        throw std::runtime_error("Directory not found: " + directory.string());
+    }
+    std::vector<std::filesystem::path> result;
+    append_regular_files(directory, result);
+    return result;
+}
+
+DirectoryWatcher::DirectoryWatcher(std::filesystem::path directory)
+    : directory(std::move(directory))
+{
+#ifdef CHESS_SCORE_CALCULATOR_HAS_INOTIFY
+    if (!std::filesystem::is_directory(this->directory)) {
+        throw std::runtime_error("Directory not found: " + this->directory.string());
+    }
+    inotify_fd = ::inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    event_fd = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if ((inotify_fd == -1) || (event_fd == -1)) {
+        throw_system_error("Cannot create directory watcher");
+    }
+    add_watches(this->directory);
+    if (watched_directories.empty()) {
+        throw std::runtime_error("Directory not found: " + this->directory.string());
+    }
+#else
+    throw std::runtime_error("Watch mode is only available on Linux");
+#endif
+}
+
+DirectoryWatcher::~DirectoryWatcher()
+{
+#ifdef CHESS_SCORE_CALCULATOR_HAS_INOTIFY
+    for (const int fd : { inotify_fd, event_fd }) {
+        if (fd != -1) {
+            ::close(fd);
+        }
+    }
+#endif
+}
+
+std::vector<FileChange> DirectoryWatcher::wait_changes()
+{
+    std::vector<FileChange> result;
+#ifdef CHESS_SCORE_CALCULATOR_HAS_INOTIFY
+    // events are aligned to their header, so the buffer is too
+    alignas(inotify_event) std::array<char, 64 * 1024> buffer;
+    while (result.empty() && !is_stopped.load()) {
+        std::array<pollfd, 2> poll_fds { pollfd { inotify_fd, POLLIN, 0 }, pollfd { event_fd, POLLIN, 0 } };
+        if (::poll(poll_fds.data(), poll_fds.size(), -1) == -1) {
+            if (errno == EINTR) {
+                continue;
+            }
+            throw_system_error("Cannot wait for directory changes");
+        }
+        // drain every queued event
+        while (true) {
+            const ssize_t size = ::read(inotify_fd, buffer.data(), buffer.size());
+            if (size == -1) {
+                if ((errno == EAGAIN) || (errno == EINTR)) {
+                    break;
+                }
+                throw_system_error("Cannot read directory changes");
+            }
+            for (ssize_t offset = 0; offset < size;) {
+                const auto* event = reinterpret_cast<const inotify_event*>(buffer.data() + offset);
+                offset += static_cast<ssize_t>(sizeof(inotify_event) + event->len);
+                if (event->mask & IN_Q_OVERFLOW) {
+                    // changes are lost, so the files are listed from scratch, and directories created meanwhile are watched
+                    result.push_back(FileChange { directory, true, true });
+                    add_watches(directory);
+                    for (std::filesystem::path& file : get_regular_files(directory)) {
+                        result.push_back(FileChange { std::move(file), false });
+                    }
+                    continue;
+                }
+                if (event->mask & IN_IGNORED) {
+                    watched_directories.erase(event->wd);
+                    continue;
+                }
+                const auto it = watched_directories.find(event->wd);
+                if ((it == watched_directories.end()) || (event->len == 0)) {
+                    continue;
+                }
+                const std::filesystem::path path = it->second / event->name;
+                if (event->mask & IN_ISDIR) {
+                    // files may be written before the new directory is watched
+                    if (event->mask & (IN_CREATE | IN_MOVED_TO)) {
+                        add_watches(path);
+                        std::vector<std::filesystem::path> files;
+                        append_regular_files(path, files);
+                        for (std::filesystem::path& file : files) {
+                            result.push_back(FileChange { std::move(file), false });
+                        }
+                    } else if (event->mask & (IN_DELETE | IN_MOVED_FROM)) {
+                        // a moved out directory keeps its watches, which would report it under its old path
+                        if (event->mask & IN_MOVED_FROM) {
+                            remove_watches(path);
+                        }
+                        result.push_back(FileChange { path, true, true });
+                    }
+                } else if (event->mask & (IN_CLOSE_WRITE | IN_MOVED_TO)) {
+                    result.push_back(FileChange { path, false });
+                } else if (event->mask & (IN_DELETE | IN_MOVED_FROM)) {
+                    result.push_back(FileChange { path, true });
+                }
+            }
+        }
+    }
+    if (is_stopped.load()) {
+        result.clear();
+    }
+    remove_superseded_changes(result);
+#endif
+    return result;
+}
+
+void DirectoryWatcher::stop() noexcept
+{
+    is_stopped.store(true);
+#ifdef CHESS_SCORE_CALCULATOR_HAS_INOTIFY
+    const std::uint64_t count = 1;
+    [[maybe_unused]] const ssize_t size = ::write(event_fd, &count, sizeof(count));
+#endif
+}
+
+void DirectoryWatcher::add_watches(const std::filesystem::path& directory)
+{
+#ifdef CHESS_SCORE_CALCULATOR_HAS_INOTIFY
+    constexpr std::uint32_t mask = IN_CLOSE_WRITE | IN_CREATE | IN_MOVED_TO | IN_MOVED_FROM | IN_DELETE;
+    const int wd = ::inotify_add_watch(inotify_fd, directory.c_str(), mask | IN_ONLYDIR);
+    if (wd == -1) {
+        // a directory removed before it is watched has nothing to report
+        if ((errno == ENOENT) || (errno == ENOTDIR)) {
+            return;
+        }
+        throw_system_error("Cannot watch directory " + directory.string());
+    }
+    watched_directories[wd] = directory;
+    for_each_entry(directory, [this](const std::filesystem::directory_entry& entry) {
+        std::error_code error_code;
+        if (!entry.is_symlink(error_code) && entry.is_directory(error_code)) {
+            add_watches(entry.path());
+        }
+    });
+#endif
+}
+
+void DirectoryWatcher::remove_watches(const std::filesystem::path& directory)
+{
+#ifdef CHESS_SCORE_CALCULATOR_HAS_INOTIFY
+    for (auto it = watched_directories.begin(); it != watched_directories.end();) {
+        const auto [mismatch, end] = std::ranges::mismatch(directory, it->second);
+        if (mismatch == directory.end()) {
+            ::inotify_rm_watch(inotify_fd, it->first);
+            it = watched_directories.erase(it);
+        } else {
+            ++it;
+        }
+    }
+#else
+    static_cast<void>(directory);
+#endif
+}
+
+} // namespace chess
@@ -0,0 +1,118 @@
+#include <chess_score_calculator/epd_reader.hpp>
+////////////////////////////////////////////////////////////////////////////////
+// Standard Libraries
+#include <algorithm>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+////////////////////////////////////////////////////////////////////////////////
+// User Defined Libraries
+#include <chess_score_calculator/chessboard.hpp>
+#include <chess_score_calculator/enums.hpp>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+constexpr std::string_view whitespace = " \t\r\v\f";
+
+/// Function object to split a line into whitespace separated fields without copying
+class GetField {
+public:
+    explicit GetField(std::string_view line) noexcept
+        : line(line)
+    {
+    }
+
+    /// @returns Next field, empty if end of line is reached
+    std::string_view operator()() noexcept
+    {
+        const size_t begin = std::min(line.find_first_not_of(whitespace, position), line.size());
+        position = std::min(line.find_first_of(whitespace, begin), line.size());
+        return line.substr(begin, position - begin);
+    }
+
+    /// @returns Remaining part of the line
+    std::string_view rest() const noexcept
+    {
+        return line.substr(position);
+    }
+
+    std::string_view line;
+    size_t position = 0;
+};
+
+/// @returns Operand of the `id` operation without quotes, empty if not found
+std::string_view find_id(std::string_view operations) noexcept
+{
+    constexpr std::string_view separators = " \t\r\v\f;";
+    size_t position = 0;
+    while (true) {
+        // opcode
+        position = operations.find_first_not_of(separators, position);
+        if (position == std::string_view::npos) {
+            return {};
+        }
+        const size_t opcode_end = std::min(operations.find_first_of(separators, position), operations.size());
+        const std::string_view opcode = operations.substr(position, opcode_end - position);
+        position = std::min(operations.find_first_not_of(whitespace, opcode_end), operations.size());
+        // first operand
+        if (opcode == "id") {
+            if ((position < operations.size()) && (operations[position] == '"')) {
+                const size_t operand_end = std::min(operations.find('"', position + 1), operations.size());
+                return operations.substr(position + 1, operand_end - position - 1);
+            }
+            const size_t operand_end = std::min(operations.find_first_of(separators, position), operations.size());
+            return operations.substr(position, operand_end - position);
+        }
+        // skip until the semicolon that is not quoted
+        bool quoted = false;
+        while ((position < operations.size()) && (quoted || (operations[position] != ';'))) {
+            quoted ^= (operations[position] == '"');
+            position++;
+        }
+    }
+}
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace chess {
+
+EpdReader::EpdReader(std::string_view epd) noexcept
+    : epd(epd)
+{
+}
+
+std::optional<EpdRecord> EpdReader::next()
+{
+    while (position < epd.size()) {
+        // split the next line
+        const size_t end = std::min(epd.find('\n', position), epd.size());
+        GetField get_field(epd.substr(position, end - position));
+        position = end + 1;
+        line_number++;
+        const std::string_view piece_placement = get_field();
+        if (piece_placement.empty() || piece_placement.starts_with('#')) {
+            continue;
+        }
+        // side to move is optional
+        const std::string_view active_color = get_field();
+        if (!active_color.empty() && (active_color != "w") && (active_color != "b")) {
+            throw std::invalid_argument("Invalid side to move [" + std::string(active_color) + "] at EPD line " + std::to_string(line_number));
+        }
+        const Side side_to_move = (active_color == "b") ? Side::Black : Side::White;
+        // castling and en passant fields are not used
+        get_field();
+        get_field();
+        try {
+            return EpdRecord { find_id(get_field.rest()), line_number, Chessboard::from_fen(piece_placement), side_to_move };
+        } catch (const std::invalid_argument& e) {
+            throw std::invalid_argument(std::string(e.what()) + " at EPD line " + std::to_string(line_number));
+        }
+    }
+    return std::nullopt;
+}
+
+} // namespace chess
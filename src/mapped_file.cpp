@@ -0,0 +1,112 @@
+#include <chess_score_calculator/mapped_file.hpp>
+////////////////////////////////////////////////////////////////////////////////
+// Standard Libraries
+#include <filesystem>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#if defined(__unix__) || defined(__APPLE__)
+#define CHESS_SCORE_CALCULATOR_HAS_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#include <fstream>
+#include <iterator>
+#endif
+////////////////////////////////////////////////////////////////////////////////
+// User Defined Libraries
+#include <chess_score_calculator/stats.hpp>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace chess {
+
+MappedFile::MappedFile(const std::filesystem::path& file)
+{
+    CHESS_SCORE_CALCULATOR_STATS_TIME(FileOpen);
+    CHESS_SCORE_CALCULATOR_STATS_ADD(Files, 1);
+#ifdef CHESS_SCORE_CALCULATOR_HAS_MMAP
+    const int fd = ::open(file.c_str(), O_RDONLY | O_CLOEXEC);
+    struct stat status;
+    if ((fd == -1) || (::fstat(fd, &status) != 0) || !S_ISREG(status.st_mode)) {
+        if (fd != -1) {
+            ::close(fd);
+        }
+        throw std::runtime_error("File not found: " + file.string());
+    }
+    size = static_cast<size_t>(status.st_size);
+    // zero sized mappings are not allowed
+    if (size != 0) {
+        void* address = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (address == MAP_FAILED) {
+            ::close(fd);
+            throw std::runtime_error("Cannot map file: " + file.string());
+        }
+        data = static_cast<const char*>(address);
+    }
+    // the mapping stays valid after closing the descriptor
+    ::close(fd);
+#else
+    if (!std::filesystem::is_regular_file(file)) {
+        throw std::runtime_error("File not found: " + file.string());
+    }
+    std::ifstream ifs;
+    ifs.exceptions(std::ios_base::badbit);
+    ifs.open(file, std::ios_base::binary);
+    buffer.assign(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+#endif
+}
+
+MappedFile::~MappedFile()
+{
+    unmap();
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+    : data(std::exchange(other.data, nullptr))
+    , size(std::exchange(other.size, 0))
+    , buffer(std::move(other.buffer))
+{
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept
+{
+    if (this != &other) {
+        unmap();
+        data = std::exchange(other.data, nullptr);
+        size = std::exchange(other.size, 0);
+        buffer = std::move(other.buffer);
+    }
+    return *this;
+}
+
+std::span<const char> MappedFile::get_data() const noexcept
+{
+#ifdef CHESS_SCORE_CALCULATOR_HAS_MMAP
+    return std::span<const char>(data, size);
+#else
+    return std::span<const char>(buffer.data(), buffer.size());
+#endif
+}
+
+std::string_view MappedFile::get_view() const noexcept
+{
+    const std::span<const char> result = get_data();
+    return std::string_view(result.data(), result.size());
+}
+
+void MappedFile::unmap() noexcept
+{
+#ifdef CHESS_SCORE_CALCULATOR_HAS_MMAP
+    if (data != nullptr) {
+        ::munmap(const_cast<char*>(data), size);
+    }
+#endif
+    data = nullptr;
+    size = 0;
+}
+
+} // namespace chess
@@ -0,0 +1,44 @@
+#include <chess_score_calculator/move_evaluator.hpp>
+////////////////////////////////////////////////////////////////////////////////
+// Standard Libraries
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+////////////////////////////////////////////////////////////////////////////////
+// User Defined Libraries
+#include <chess_score_calculator/chessboard.hpp>
+#include <chess_score_calculator/enums.hpp>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+/// @returns Score of the side minus the score of its opponent
+constexpr double get_advantage(const chess::Score& score, chess::Side side) noexcept
+{
+    return (side == chess::Side::White) ? score.white - score.black : score.black - score.white;
+}
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace chess {
+
+MoveEvaluation evaluate_move(const Chessboard& chessboard, const Score& score, Side side, const Move& move)
+{
+    Chessboard copy = chessboard;
+    copy.make_move(move);
+    const Score result = copy.score();
+    return MoveEvaluation { move, result, get_advantage(result, side) - get_advantage(score, side) };
+}
+
+void select_top_moves(std::vector<MoveEvaluation>& evaluations, size_t num_moves)
+{
+    // ties keep the order of generation, so the selection is deterministic
+    std::stable_sort(evaluations.begin(), evaluations.end(), [](const MoveEvaluation& lhs, const MoveEvaluation& rhs) { return lhs.delta > rhs.delta; });
+    if ((num_moves != 0) && (num_moves < evaluations.size())) {
+        evaluations.resize(num_moves);
+    }
+}
+
+} // namespace chess
@@ -0,0 +1,109 @@
+#include <chess_score_calculator/move_generator.hpp>
+////////////////////////////////////////////////////////////////////////////////
+// Standard Libraries
+#include <array>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+////////////////////////////////////////////////////////////////////////////////
+// User Defined Libraries
+#include <chess_score_calculator/bitboard.hpp>
+#include <chess_score_calculator/chessboard.hpp>
+#include <chess_score_calculator/enums.hpp>
+#include <chess_score_calculator/piece.hpp>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+using chess::Bitboard;
+using chess::Move;
+using chess::PieceType;
+using chess::Side;
+
+/// Piece types a pawn can promote to
+constexpr std::array promotion_piece_types { PieceType::Queen, PieceType::Rook, PieceType::Bishop, PieceType::Knight };
+
+/// Tiles of the first and last rows, where a pawn promotes
+constexpr Bitboard last_rows = 0xFF000000000000FF;
+
+/// Append the moves of a pawn, one for each promotion if the target tile is at the last row
+void push_pawn_moves(std::vector<Move>& moves, int from, int to)
+{
+    const Move move { chess::to_coordinate(from), chess::to_coordinate(to), std::nullopt, false, false };
+    if (!((Bitboard { 1 } << to) & last_rows)) {
+        moves.push_back(move);
+        return;
+    }
+    for (const PieceType promotion : promotion_piece_types) {
+        moves.push_back(Move { move.from, move.to, promotion, false, false });
+    }
+}
+
+constexpr char to_char(PieceType piece_type) noexcept
+{
+    constexpr std::string_view letters = "pnbrqk";
+    return letters[static_cast<size_t>(piece_type)];
+}
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace chess {
+
+std::vector<Move> generate_moves(const Chessboard& chessboard, Side side)
+{
+    const Bitboard occupancy = chessboard.get_bitboard();
+    const Bitboard own_pieces = chessboard.get_bitboard(side);
+    // capturing the king ends the game instead of leading to a position, so the opponent king is never a target
+    const Bitboard opponent_pieces = chessboard.get_bitboard(get_opposite_side(side)) & ~chessboard.get_bitboard(PieceType::King);
+    const Bitboard blocked_tiles = occupancy & ~opponent_pieces;
+    std::vector<Move> result;
+    // a position rarely has more moves than this
+    result.reserve(64);
+    // pawns capture where they threaten, but advance where they do not
+    const int direction = (side == Side::White) ? 8 : -8;
+    const int initial_row = (side == Side::White) ? static_cast<int>(Row::_2) : static_cast<int>(Row::_7);
+    for (Bitboard pawns = own_pieces & chessboard.get_bitboard(PieceType::Pawn); pawns;) {
+        const int from = pop_square(pawns);
+        for (Bitboard captures = get_pawn_attacks(side, from) & opponent_pieces; captures;) {
+            push_pawn_moves(result, from, pop_square(captures));
+        }
+        // a pawn at the last row has no tile ahead
+        const int one_ahead = from + direction;
+        if ((one_ahead < 0) || (one_ahead >= 64) || (occupancy >> one_ahead & 1)) {
+            continue;
+        }
+        push_pawn_moves(result, from, one_ahead);
+        const int two_ahead = one_ahead + direction;
+        if ((from / 8 == initial_row) && !(occupancy >> two_ahead & 1)) {
+            push_pawn_moves(result, from, two_ahead);
+        }
+    }
+    for (const PieceType piece_type : { PieceType::Knight, PieceType::Bishop, PieceType::Rook, PieceType::Queen, PieceType::King }) {
+        for (Bitboard pieces = own_pieces & chessboard.get_bitboard(piece_type); pieces;) {
+            const int from = pop_square(pieces);
+            for (Bitboard targets = get_piece_attacks(piece_type, from, side, occupancy) & ~blocked_tiles; targets;) {
+                result.push_back(Move { to_coordinate(from), to_coordinate(pop_square(targets)), std::nullopt, false, false });
+            }
+        }
+    }
+    return result;
+}
+
+std::string to_string(const Move& move)
+{
+    std::string result {
+        static_cast<char>('a' + static_cast<int>(move.from.col)),
+        static_cast<char>('1' + static_cast<int>(move.from.row)),
+        static_cast<char>('a' + static_cast<int>(move.to.col)),
+        static_cast<char>('1' + static_cast<int>(move.to.row)),
+    };
+    if (move.promotion) {
+        result += to_char(*move.promotion);
+    }
+    return result;
+}
+
+} // namespace chess
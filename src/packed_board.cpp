@@ -0,0 +1,56 @@
+#include <chess_score_calculator/packed_board.hpp>
+////////////////////////////////////////////////////////////////////////////////
+// Standard Libraries
+#include <cstring>
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+////////////////////////////////////////////////////////////////////////////////
+// User Defined Libraries
+#include <chess_score_calculator/bitboard.hpp>
+#include <chess_score_calculator/chessboard.hpp>
+#include <chess_score_calculator/enums.hpp>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace chess {
+
+PackedBoard pack(const Chessboard& chessboard) noexcept
+{
+    PackedBoard result {};
+    for (int type = static_cast<int>(PieceType::Pawn); type <= static_cast<int>(PieceType::King); type++) {
+        const Bitboard pieces = chessboard.get_bitboard(static_cast<PieceType>(type));
+        for (Bitboard whites = pieces & chessboard.get_bitboard(Side::White); whites;) {
+            const int square = pop_square(whites);
+            result.nibbles[square / 2] |= static_cast<std::uint8_t>((type + 1) << (4 * (square % 2)));
+        }
+        for (Bitboard blacks = pieces & chessboard.get_bitboard(Side::Black); blacks;) {
+            const int square = pop_square(blacks);
+            result.nibbles[square / 2] |= static_cast<std::uint8_t>((8 | (type + 1)) << (4 * (square % 2)));
+        }
+    }
+    return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+PackedBoardFile::PackedBoardFile(const std::filesystem::path& file)
+    : mapped_file(file)
+{
+    if (mapped_file.get_data().size() % sizeof(PackedBoard) != 0) {
+        throw std::invalid_argument("Size of packed board file is not a multiple of " + std::to_string(sizeof(PackedBoard)) + ": " + file.string());
+    }
+}
+
+size_t PackedBoardFile::size() const noexcept
+{
+    return mapped_file.get_data().size() / sizeof(PackedBoard);
+}
+
+PackedBoard PackedBoardFile::operator[](size_t index) const noexcept
+{
+    PackedBoard result;
+    std::memcpy(result.nibbles.data(), mapped_file.get_data().data() + index * sizeof(PackedBoard), sizeof(PackedBoard));
+    return result;
+}
+
+} // namespace chess
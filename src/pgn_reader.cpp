@@ -0,0 +1,342 @@
+#include <chess_score_calculator/pgn_reader.hpp>
+////////////////////////////////////////////////////////////////////////////////
+// Standard Libraries
+#include <cstdlib>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+////////////////////////////////////////////////////////////////////////////////
+// User Defined Libraries
+#include <chess_score_calculator/bitboard.hpp>
+#include <chess_score_calculator/chessboard.hpp>
+#include <chess_score_calculator/enums.hpp>
+#include <chess_score_calculator/piece.hpp>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+using chess::Bitboard;
+using chess::Column;
+using chess::Coordinate;
+using chess::PieceType;
+using chess::Row;
+using chess::Side;
+
+constexpr std::string_view initial_fen = "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w";
+
+constexpr bool is_whitespace(char ch) noexcept
+{
+    return (ch == ' ') || (ch == '\n') || (ch == '\r') || (ch == '\t') || (ch == '\v') || (ch == '\f');
+}
+
+constexpr bool is_digit(char ch) noexcept
+{
+    return ('0' <= ch) && (ch <= '9');
+}
+
+constexpr bool is_result(std::string_view token) noexcept
+{
+    return (token == "1-0") || (token == "0-1") || (token == "1/2-1/2") || (token == "*");
+}
+
+[[noreturn]] void throw_invalid_move(std::string description, std::string_view san)
+{
+    throw std::invalid_argument(description + " [" + std::string(san) + "]");
+}
+
+/// @returns Piece type of a SAN piece letter, empty if not a piece letter
+std::optional<PieceType> to_piece_type(char ch) noexcept
+{
+    switch (ch) {
+    case 'N':
+        return PieceType::Knight;
+    case 'B':
+        return PieceType::Bishop;
+    case 'R':
+        return PieceType::Rook;
+    case 'Q':
+        return PieceType::Queen;
+    case 'K':
+        return PieceType::King;
+    default:
+        return std::nullopt;
+    }
+}
+
+/// @returns Row a pawn moves towards, +1 for white and -1 for black
+constexpr int get_pawn_direction(Side side) noexcept
+{
+    return (side == Side::White) ? 1 : -1;
+}
+
+/// @returns Whether the king of side is threatened after making the move, the board is unchanged afterwards
+bool is_leaving_king_threatened(chess::Chessboard& chessboard, Side side, const chess::Move& move)
+{
+    chessboard.make_move(move);
+    const bool result = (chessboard.get_threatened_bitboard(side) & chessboard.get_bitboard(PieceType::King)) != 0;
+    chessboard.unmake_move();
+    return result;
+}
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace chess {
+
+PgnReader::PgnReader(std::string_view pgn) noexcept
+    : pgn(pgn)
+{
+}
+
+std::optional<PgnGame> PgnReader::next()
+{
+    const auto skip_whitespace = [this] {
+        while ((position < pgn.size()) && is_whitespace(pgn[position])) {
+            position++;
+        }
+    };
+    skip_whitespace();
+    if (position == pgn.size()) {
+        return std::nullopt;
+    }
+    PgnGame result { ++game_number, {}, {} };
+    // tag pairs, e.g. [FEN "8/8/8/8/8/8/8/K6k w - - 0 1"]
+    for (; (position < pgn.size()) && ((pgn[position] == '[') || (pgn[position] == '%')); skip_whitespace()) {
+        if (pgn[position] == '%') {
+            skip_line();
+            continue;
+        }
+        // the value is a quoted string, which may hold brackets and escaped quotes
+        size_t end = position + 1;
+        for (bool is_quoted = false; (end < pgn.size()) && (is_quoted || (pgn[end] != ']')); end++) {
+            if (pgn[end] == '"') {
+                is_quoted = !is_quoted;
+            } else if (is_quoted && (pgn[end] == '\\')) {
+                end++;
+            }
+        }
+        if (end >= pgn.size()) {
+            throw std::invalid_argument("Unterminated PGN tag at game " + std::to_string(game_number));
+        }
+        const std::string_view tag = pgn.substr(position + 1, end - position - 1);
+        position = end + 1;
+        const size_t value_begin = tag.find('"');
+        const size_t value_end = tag.rfind('"');
+        if (tag.starts_with("FEN") && (value_begin != std::string_view::npos) && (value_end > value_begin)) {
+            result.fen = tag.substr(value_begin + 1, value_end - value_begin - 1);
+        }
+    }
+    // movetext until a result or the tags of the next game
+    while (skip_whitespace(), position < pgn.size()) {
+        const char ch = pgn[position];
+        if (ch == '[') {
+            break;
+        } else if (ch == '{') {
+            const size_t end = pgn.find('}', position);
+            if (end == std::string_view::npos) {
+                throw std::invalid_argument("Unterminated PGN comment at game " + std::to_string(game_number));
+            }
+            position = end + 1;
+        } else if ((ch == ';') || ((ch == '%') && is_at_line_start())) {
+            skip_line();
+        } else if (ch == '(') {
+            // variations nest, and their comments may hold parentheses
+            size_t depth = 0;
+            for (; position < pgn.size(); position++) {
+                if (pgn[position] == '{') {
+                    position = pgn.find('}', position);
+                    if (position == std::string_view::npos) {
+                        break;
+                    }
+                } else if (pgn[position] == '(') {
+                    depth++;
+                } else if ((pgn[position] == ')') && (--depth == 0)) {
+                    break;
+                }
+            }
+            if (position >= pgn.size()) {
+                throw std::invalid_argument("Unterminated PGN variation at game " + std::to_string(game_number));
+            }
+            position++;
+        } else {
+            const size_t begin = position;
+            while ((position < pgn.size()) && !is_whitespace(pgn[position]) && (std::string_view("{}();[").find(pgn[position]) == std::string_view::npos)) {
+                position++;
+            }
+            std::string_view token = pgn.substr(begin, position - begin);
+            if (is_result(token)) {
+                break;
+            }
+            // move numbers may be joined to the move, e.g. `12.Nf3` or `12...Nf3`
+            size_t num_digits = 0;
+            while ((num_digits < token.size()) && is_digit(token[num_digits])) {
+                num_digits++;
+            }
+            if ((num_digits > 0) && (num_digits < token.size()) && (token[num_digits] == '.')) {
+                token.remove_prefix(token.find_first_not_of('.', num_digits) == std::string_view::npos ? token.size() : token.find_first_not_of('.', num_digits));
+            }
+            if (!token.empty() && !token.starts_with('$')) {
+                result.moves.push_back(token);
+            }
+        }
+    }
+    return result;
+}
+
+bool PgnReader::is_at_line_start() const noexcept
+{
+    return (position == 0) || (pgn[position - 1] == '\n');
+}
+
+void PgnReader::skip_line() noexcept
+{
+    const size_t end = pgn.find('\n', position);
+    position = (end == std::string_view::npos) ? pgn.size() : end + 1;
+}
+
+Move to_move(Chessboard& chessboard, Side side, std::string_view san)
+{
+    // check, mate and annotation suffixes do not affect the move
+    std::string_view text = san;
+    while (!text.empty() && (std::string_view("+#!?").find(text.back()) != std::string_view::npos)) {
+        text.remove_suffix(1);
+    }
+    const Bitboard own_pieces = chessboard.get_bitboard(side);
+    const Bitboard kings = own_pieces & chessboard.get_bitboard(PieceType::King);
+    if ((text == "O-O") || (text == "0-0") || (text == "O-O-O") || (text == "0-0-0")) {
+        if (!kings) {
+            throw_invalid_move("No king to castle", san);
+        }
+        Bitboard king = kings;
+        const Coordinate from = to_coordinate(pop_square(king));
+        const std::optional<Coordinate> to = get_coordinate_at(from, 0, (text.length() == 3) ? 2 : -2);
+        // the rook of the side the king moves towards must be at its corner
+        const Coordinate rook { from.row, (text.length() == 3) ? Column::h : Column::a };
+        if (!to || !(own_pieces & chessboard.get_bitboard(PieceType::Rook) & to_bitboard(rook))) {
+            throw_invalid_move("Invalid castling", san);
+        }
+        return Move { from, *to, std::nullopt, false, true };
+    }
+    // promotion, e.g. `e8=Q` or `e8Q`
+    std::optional<PieceType> promotion;
+    if ((text.size() >= 2) && to_piece_type(text.back()) && ((text[text.size() - 2] == '=') || is_digit(text[text.size() - 2]))) {
+        promotion = to_piece_type(text.back());
+        text.remove_suffix((text[text.size() - 2] == '=') ? 2 : 1);
+    }
+    const std::optional<PieceType> piece_letter = text.empty() ? std::nullopt : to_piece_type(text.front());
+    const PieceType piece_type = piece_letter.value_or(PieceType::Pawn);
+    if (piece_letter) {
+        text.remove_prefix(1);
+    }
+    if ((text.size() < 2) || (text[text.size() - 2] < 'a') || (text[text.size() - 2] > 'h') || (text.back() < '1') || (text.back() > '8')) {
+        throw_invalid_move("Invalid move", san);
+    }
+    const Coordinate to { static_cast<Row>(text.back() - '1'), static_cast<Column>(text[text.size() - 2] - 'a') };
+    text.remove_suffix(2);
+    // what remains tells the source tile apart, and whether the move captures
+    std::optional<Column> from_col;
+    std::optional<Row> from_row;
+    bool is_capture = false;
+    for (const char ch : text) {
+        if ((ch == 'x') || (ch == ':')) {
+            is_capture = true;
+        } else if (('a' <= ch) && (ch <= 'h')) {
+            from_col = static_cast<Column>(ch - 'a');
+        } else if (('1' <= ch) && (ch <= '8')) {
+            from_row = static_cast<Row>(ch - '1');
+        } else {
+            throw_invalid_move("Invalid move", san);
+        }
+    }
+    if (own_pieces & to_bitboard(to)) {
+        throw_invalid_move("Target tile is occupied by the moving side", san);
+    }
+    const int last_row = (side == Side::White) ? static_cast<int>(Row::_8) : static_cast<int>(Row::_1);
+    if ((piece_type == PieceType::Pawn) && (static_cast<int>(to.row) == last_row) && !promotion) {
+        throw_invalid_move("Missing promotion", san);
+    }
+    if (promotion && ((piece_type != PieceType::Pawn) || (static_cast<int>(to.row) != last_row) || (*promotion == PieceType::King))) {
+        throw_invalid_move("Invalid promotion", san);
+    }
+
+    if (piece_type == PieceType::Pawn) {
+        const int direction = get_pawn_direction(side);
+        const Bitboard pawns = own_pieces & chessboard.get_bitboard(PieceType::Pawn);
+        const bool is_target_empty = !(chessboard.get_bitboard() & to_bitboard(to));
+        if (is_capture || from_col) {
+            // a pawn captures diagonally forward, onto an empty tile only en passant
+            const std::optional<Coordinate> from = from_col ? get_coordinate_at(Coordinate { to.row, *from_col }, -direction, 0) : std::nullopt;
+            if (!from || !(pawns & to_bitboard(*from)) || (std::abs(static_cast<int>(from->col) - static_cast<int>(to.col)) != 1)) {
+                throw_invalid_move("No pawn can capture", san);
+            }
+            return Move { *from, to, promotion, is_target_empty, false };
+        }
+        // a pawn advances one tile, or two from its initial row over an empty tile
+        const std::optional<Coordinate> one_back = get_coordinate_at(to, -direction, 0);
+        if (one_back && (pawns & to_bitboard(*one_back)) && is_target_empty) {
+            return Move { *one_back, to, promotion, false, false };
+        }
+        const std::optional<Coordinate> two_back = get_coordinate_at(to, -2 * direction, 0);
+        const int initial_row = (side == Side::White) ? static_cast<int>(Row::_2) : static_cast<int>(Row::_7);
+        if (two_back && (static_cast<int>(two_back->row) == initial_row) && (pawns & to_bitboard(*two_back)) && is_target_empty && !(chessboard.get_bitboard() & to_bitboard(*one_back))) {
+            return Move { *two_back, to, promotion, false, false };
+        }
+        throw_invalid_move("No pawn can move", san);
+    }
+
+    std::vector<Move> candidates;
+    const Bitboard occupancy = chessboard.get_bitboard();
+    for (Bitboard pieces = own_pieces & chessboard.get_bitboard(piece_type); pieces;) {
+        const int square = pop_square(pieces);
+        const Coordinate from = to_coordinate(square);
+        if ((from_col && (from.col != *from_col)) || (from_row && (from.row != *from_row))) {
+            continue;
+        }
+        if (get_piece_attacks(piece_type, square, side, occupancy) & to_bitboard(to)) {
+            candidates.push_back(Move { from, to, std::nullopt, false, false });
+        }
+    }
+    // SAN omits the tile of a piece that cannot move legally, i.e. a pinned one
+    if (candidates.size() > 1) {
+        std::erase_if(candidates, [&](const Move& move) { return is_leaving_king_threatened(chessboard, side, move); });
+    }
+    if (candidates.empty()) {
+        throw_invalid_move("No piece can move", san);
+    }
+    if (candidates.size() > 1) {
+        throw_invalid_move("Ambiguous move", san);
+    }
+    return candidates.front();
+}
+
+GameReplay::GameReplay(const PgnGame& game)
+    : game(game)
+    , chessboard(Chessboard::from_fen(game.fen.empty() ? initial_fen : game.fen))
+{
+    // the active color follows the piece placement
+    const std::string_view fen = game.fen.empty() ? initial_fen : game.fen;
+    const size_t field = fen.find_first_not_of(' ', fen.find(' '));
+    if ((field != std::string_view::npos) && (fen[field] == 'b')) {
+        side_to_move = Side::Black;
+    }
+}
+
+bool GameReplay::play_next_move()
+{
+    if (num_plies == game.moves.size()) {
+        return false;
+    }
+    try {
+        chessboard.make_move(to_move(chessboard, side_to_move, game.moves[num_plies]));
+    } catch (const std::invalid_argument& e) {
+        throw std::invalid_argument(std::string(e.what()) + " at game " + std::to_string(game.game_number) + " ply " + std::to_string(num_plies + 1));
+    }
+    side_to_move = get_opposite_side(side_to_move);
+    num_plies++;
+    return true;
+}
+
+} // namespace chess
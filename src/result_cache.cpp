@@ -0,0 +1,289 @@
+#include <chess_score_calculator/result_cache.hpp>
+////////////////////////////////////////////////////////////////////////////////
+// Standard Libraries
+#include <algorithm>
+#include <charconv>
+#include <format>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <stdexcept>
+#include <string_view>
+#include <system_error>
+#include <utility>
+#if defined(__unix__) || defined(__APPLE__)
+#define CHESS_SCORE_CALCULATOR_HAS_MKSTEMP
+#include <cerrno>
+#include <cstdlib>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#include <random>
+#endif
+////////////////////////////////////////////////////////////////////////////////
+// User Defined Libraries
+#include <chess_score_calculator/mapped_file.hpp>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+constexpr std::string_view header = "# chess_score_calculator result cache 2";
+
+[[noreturn]] void throw_invalid_line(const std::filesystem::path& cache_file, size_t line_number)
+{
+    throw std::invalid_argument("Invalid result cache file at line " + std::to_string(line_number) + ": " + cache_file.string());
+}
+
+/// Function object to read the space separated fields of a cache file line or throw invalid argument
+class GetField {
+public:
+    GetField(std::string_view line, const std::filesystem::path& cache_file, size_t line_number) noexcept
+        : line(line)
+        , cache_file(cache_file)
+        , line_number(line_number)
+    {
+    }
+
+    template <typename Integer>
+    Integer operator()(int base = 10)
+    {
+        Integer result {};
+        // the last field of a line has no separator after it
+        const size_t end = std::min(line.find(' '), line.size());
+        const auto [ptr, ec] = std::from_chars(line.data(), line.data() + end, result, base);
+        if ((ec != std::errc {}) || (ptr != line.data() + end)) {
+            throw_invalid_line(cache_file, line_number);
+        }
+        line.remove_prefix(std::min(end + 1, line.size()));
+        return result;
+    }
+
+    /// @returns The rest of the line
+    std::string_view get_rest() const noexcept
+    {
+        return line;
+    }
+
+private:
+    std::string_view line;
+    const std::filesystem::path& cache_file;
+    size_t line_number;
+};
+
+/// Escape the backslashes and line feeds of a key, so that it fits in a line
+std::string escape_key(std::string_view key)
+{
+    std::string result;
+    result.reserve(key.size());
+    for (const char ch : key) {
+        if (ch == '\\') {
+            result += "\\\\";
+        } else if (ch == '\n') {
+            result += "\\n";
+        } else {
+            result += ch;
+        }
+    }
+    return result;
+}
+
+/// @returns Key escaped by #escape_key, empty if the escapes are invalid
+std::optional<std::string> unescape_key(std::string_view escaped_key)
+{
+    std::string result;
+    result.reserve(escaped_key.size());
+    for (size_t i = 0; i < escaped_key.size(); i++) {
+        if (escaped_key[i] != '\\') {
+            result += escaped_key[i];
+            continue;
+        }
+        if (++i == escaped_key.size()) {
+            return std::nullopt;
+        }
+        if (escaped_key[i] == '\\') {
+            result += '\\';
+        } else if (escaped_key[i] == 'n') {
+            result += '\n';
+        } else {
+            return std::nullopt;
+        }
+    }
+    return result;
+}
+
+/**
+Create a file next to given file with a name no other run uses
+
+@returns Created file and its descriptor, which is -1 if descriptors are not available
+@warning Throws if the file cannot be created
+*/
+std::pair<std::filesystem::path, int> create_temporary_file(const std::filesystem::path& file)
+{
+#ifdef CHESS_SCORE_CALCULATOR_HAS_MKSTEMP
+    std::string name = file.string() + ".XXXXXX";
+    const int fd = ::mkstemp(name.data());
+    if (fd == -1) {
+        throw std::system_error(errno, std::generic_category(), "Cannot create " + name);
+    }
+    // mkstemp only permits the owner, but the cache file is as readable as any other output
+    ::fchmod(fd, S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH);
+    return { std::filesystem::path(std::move(name)), fd };
+#else
+    std::random_device random_device;
+    std::filesystem::path result = file;
+    result += std::format(".{:08x}", random_device());
+    return { std::move(result), -1 };
+#endif
+}
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace chess {
+
+std::optional<FileStamp> get_file_stamp(const std::filesystem::path& file) noexcept
+{
+    std::error_code ec;
+    const std::uintmax_t file_size = std::filesystem::file_size(file, ec);
+    if (ec) {
+        return std::nullopt;
+    }
+    const std::filesystem::file_time_type modification_time = std::filesystem::last_write_time(file, ec);
+    if (ec) {
+        return std::nullopt;
+    }
+    return FileStamp { file_size, static_cast<std::int64_t>(modification_time.time_since_epoch().count()) };
+}
+
+ResultCache::ResultCache(std::filesystem::path cache_file)
+    : cache_file(std::move(cache_file))
+{
+    if (!std::filesystem::exists(this->cache_file)) {
+        return;
+    }
+    // the cache only saves time, so a corrupt file or one of another version must not fail the run
+    try {
+        load();
+    } catch (const std::exception& e) {
+        loaded_entries.clear();
+        std::clog << "Ignoring the result cache, which is replaced at the end: " << e.what() << '\n';
+    }
+}
+
+std::string ResultCache::get_key(const std::filesystem::path& board_file)
+{
+    return std::filesystem::absolute(board_file).lexically_normal().string();
+}
+
+std::optional<ResultCacheEntry> ResultCache::find(const std::string& key) const
+{
+    const auto it = loaded_entries.find(key);
+    if (it == loaded_entries.end()) {
+        return std::nullopt;
+    }
+    return it->second;
+}
+
+void ResultCache::insert(std::string key, const ResultCacheEntry& entry)
+{
+    inserted_entries.insert_or_assign(std::move(key), entry);
+}
+
+void ResultCache::load()
+{
+    const MappedFile mapped_file(cache_file);
+    std::string_view content = mapped_file.get_view();
+    size_t line_number = 0;
+    while (!content.empty()) {
+        const size_t end = std::min(content.find('\n'), content.size());
+        const std::string_view line = content.substr(0, end);
+        content.remove_prefix(std::min(end + 1, content.size()));
+        line_number++;
+        if (line_number == 1) {
+            if (line != header) {
+                throw std::invalid_argument("Invalid result cache file header: " + cache_file.string());
+            }
+            continue;
+        }
+        if (line.empty()) {
+            continue;
+        }
+        // size, modification time, hash, half points of both sides and the key at the end
+        GetField get_field(line, cache_file, line_number);
+        ResultCacheEntry entry {};
+        entry.file_stamp.file_size = get_field.operator()<std::uintmax_t>();
+        entry.file_stamp.modification_time = get_field.operator()<std::int64_t>();
+        entry.hash = get_field.operator()<std::uint64_t>(16);
+        entry.score.white = get_field.operator()<unsigned>() / 2.0;
+        entry.score.black = get_field.operator()<unsigned>() / 2.0;
+        std::optional<std::string> key = unescape_key(get_field.get_rest());
+        if (!key || key->empty()) {
+            throw_invalid_line(cache_file, line_number);
+        }
+        loaded_entries.insert_or_assign(std::move(*key), entry);
+    }
+    if (line_number == 0) {
+        throw std::invalid_argument("Invalid result cache file header: " + cache_file.string());
+    }
+}
+
+void ResultCache::save() const
+{
+    std::string content(header);
+    content += '\n';
+    const auto append_entry = [&content](const std::string& key, const ResultCacheEntry& entry) {
+        // scores are multiples of a half, so they are stored exactly as half points
+        std::format_to(std::back_inserter(content), "{} {} {:x} {} {} {}\n", entry.file_stamp.file_size, entry.file_stamp.modification_time, entry.hash,
+            static_cast<unsigned>(entry.score.white * 2), static_cast<unsigned>(entry.score.black * 2), escape_key(key));
+    };
+    for (const auto& [key, entry] : inserted_entries) {
+        append_entry(key, entry);
+    }
+    // entries of other runs, e.g. of other directories, are kept while their files exist
+    for (const auto& [key, entry] : loaded_entries) {
+        std::error_code ec;
+        if (!inserted_entries.contains(key) && std::filesystem::exists(key, ec)) {
+            append_entry(key, entry);
+        }
+    }
+    // write to a temporary file first, so an interrupted run keeps the previous cache, and concurrent
+    // runs never write the same temporary file
+    auto [temporary_file, fd] = create_temporary_file(cache_file);
+    try {
+#ifdef CHESS_SCORE_CALCULATOR_HAS_MKSTEMP
+        for (std::string_view rest = content; !rest.empty();) {
+            const ssize_t size = ::write(fd, rest.data(), rest.size());
+            if (size == -1) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                throw std::system_error(errno, std::generic_category(), "Cannot write " + temporary_file.string());
+            }
+            rest.remove_prefix(static_cast<size_t>(size));
+        }
+        const int result = ::close(std::exchange(fd, -1));
+        if (result != 0) {
+            throw std::system_error(errno, std::generic_category(), "Cannot write " + temporary_file.string());
+        }
+#else
+        std::ofstream ofs;
+        ofs.exceptions(std::ios_base::badbit | std::ios_base::failbit);
+        ofs.open(temporary_file, std::ios_base::binary);
+        ofs.write(content.data(), static_cast<std::streamsize>(content.size()));
+        ofs.close();
+#endif
+        std::filesystem::rename(temporary_file, cache_file);
+    } catch (...) {
+#ifdef CHESS_SCORE_CALCULATOR_HAS_MKSTEMP
+        if (fd != -1) {
+            ::close(fd);
+        }
+#endif
+        std::error_code ec;
+        std::filesystem::remove(temporary_file, ec);
+        throw;
+    }
+}
+
+} // namespace chess
@@ -0,0 +1,244 @@
+#include <chess_score_calculator/result_writer.hpp>
+////////////////////////////////////////////////////////////////////////////////
+// Standard Libraries
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <exception>
+#include <filesystem>
+#include <format>
+#include <iostream>
+#include <iterator>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+/// Minimum width of the score columns of the table
+constexpr size_t score_column_width = 5;
+
+/**
+Append a score in its shortest form, e.g. `93.5` or `64`, same as `{}` of std::format
+
+Rows are mostly scores, and std::to_chars is much faster than a format string with width specifiers.
+@param width Minimum width, the score is padded by trailing spaces
+*/
+void append_score(std::string& buffer, double score, size_t width = 0)
+{
+    std::array<char, 32> chars;
+    const char* end = std::to_chars(chars.data(), chars.data() + chars.size(), score).ptr;
+    const auto length = static_cast<size_t>(end - chars.data());
+    buffer.append(chars.data(), length);
+    if (length < width) {
+        buffer.append(width - length, ' ');
+    }
+}
+
+/// Append a CSV field, quoted only if it contains a separator, quote or line break
+void append_csv_field(std::string& buffer, std::string_view field)
+{
+    if (field.find_first_of(",\"\r\n") == std::string_view::npos) {
+        buffer += field;
+        return;
+    }
+    buffer += '"';
+    for (const char ch : field) {
+        if (ch == '"') {
+            buffer += '"';
+        }
+        buffer += ch;
+    }
+    buffer += '"';
+}
+
+/// Append a JSON string literal
+void append_json_string(std::string& buffer, std::string_view text)
+{
+    buffer += '"';
+    for (const char ch : text) {
+        switch (ch) {
+        case '"':
+            buffer += "\\\"";
+            break;
+        case '\\':
+            buffer += "\\\\";
+            break;
+        case '\n':
+            buffer += "\\n";
+            break;
+        case '\r':
+            buffer += "\\r";
+            break;
+        case '\t':
+            buffer += "\\t";
+            break;
+        default:
+            if (static_cast<unsigned char>(ch) < 0x20) {
+                std::format_to(std::back_inserter(buffer), "\\u{:04x}", static_cast<unsigned>(ch));
+            } else {
+                buffer += ch;
+            }
+        }
+    }
+    buffer += '"';
+}
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace chess {
+
+std::string_view to_string(OutputFormat output_format) noexcept
+{
+    switch (output_format) {
+    case OutputFormat::Table:
+        return "table";
+    case OutputFormat::Csv:
+        return "csv";
+    case OutputFormat::JsonLines:
+        return "jsonl";
+    }
+    return "";
+}
+
+OutputFormat to_output_format(std::string_view name)
+{
+    for (const OutputFormat output_format : { OutputFormat::Table, OutputFormat::Csv, OutputFormat::JsonLines }) {
+        if (name == to_string(output_format)) {
+            return output_format;
+        }
+    }
+    throw std::invalid_argument("Invalid output format [" + std::string(name) + "]");
+}
+
+ResultWriter::ResultWriter(OutputFormat output_format, size_t filename_column_width, const std::filesystem::path& output_file, bool is_echoed, bool has_delta_column)
+    : output_format(output_format)
+    , filename_column_width(std::max(filename_column_width, filename_header.length()))
+    , output_file(output_file)
+    , is_written_to_stdout(is_echoed || (output_file == "-"))
+{
+    if (output_file != "-") {
+        ofs.open(output_file, std::ios_base::binary);
+        if (!ofs.is_open()) {
+            throw std::runtime_error("Cannot write " + output_file.string());
+        }
+    }
+    buffer.reserve(buffer_size);
+    switch (output_format) {
+    case OutputFormat::Table:
+        std::format_to(std::back_inserter(buffer), "| {:{}} | White | Black |{}\n", filename_header, this->filename_column_width, has_delta_column ? " Delta |" : "");
+        std::format_to(std::back_inserter(buffer), "| {:-<{}} | ----- | ----- |{}\n", "", this->filename_column_width, has_delta_column ? " ----- |" : "");
+        break;
+    case OutputFormat::Csv:
+        buffer += has_delta_column ? "filename,white,black,delta\n" : "filename,white,black\n";
+        break;
+    case OutputFormat::JsonLines:
+        break;
+    }
+}
+
+ResultWriter::~ResultWriter()
+{
+    if (is_closed) {
+        return;
+    }
+    try {
+        flush();
+    } catch (const std::exception&) {
+        // a destructor cannot report the error, the callers that need to know close the writer
+    }
+}
+
+void ResultWriter::write_row(std::string_view filename, const Score& score)
+{
+    append_row(filename, score, std::nullopt);
+}
+
+void ResultWriter::write_row(std::string_view filename, const Score& score, double delta)
+{
+    append_row(filename, score, delta);
+}
+
+void ResultWriter::append_row(std::string_view filename, const Score& score, std::optional<double> delta)
+{
+    switch (output_format) {
+    case OutputFormat::Table:
+        buffer += "| ";
+        buffer += filename;
+        if (filename.length() < filename_column_width) {
+            buffer.append(filename_column_width - filename.length(), ' ');
+        }
+        buffer += " | ";
+        append_score(buffer, score.white, score_column_width);
+        buffer += " | ";
+        append_score(buffer, score.black, score_column_width);
+        if (delta) {
+            buffer += " | ";
+            append_score(buffer, *delta, score_column_width);
+        }
+        buffer += " |\n";
+        break;
+    case OutputFormat::Csv:
+        append_csv_field(buffer, filename);
+        buffer += ',';
+        append_score(buffer, score.white);
+        buffer += ',';
+        append_score(buffer, score.black);
+        if (delta) {
+            buffer += ',';
+            append_score(buffer, *delta);
+        }
+        buffer += '\n';
+        break;
+    case OutputFormat::JsonLines:
+        buffer += "{\"filename\":";
+        append_json_string(buffer, filename);
+        buffer += ",\"white\":";
+        append_score(buffer, score.white);
+        buffer += ",\"black\":";
+        append_score(buffer, score.black);
+        if (delta) {
+            buffer += ",\"delta\":";
+            append_score(buffer, *delta);
+        }
+        buffer += "}\n";
+        break;
+    }
+    if (buffer.size() >= buffer_size) {
+        flush();
+    }
+}
+
+void ResultWriter::flush()
+{
+    if (is_written_to_stdout) {
+        std::cout.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        std::cout.flush();
+    }
+    if (ofs.is_open()) {
+        ofs.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        ofs.flush();
+        if (!ofs) {
+            throw std::runtime_error("Cannot write " + output_file.string());
+        }
+    }
+    buffer.clear();
+}
+
+void ResultWriter::close()
+{
+    flush();
+    is_closed = true;
+    if (ofs.is_open()) {
+        ofs.close();
+        if (!ofs) {
+            throw std::runtime_error("Cannot write " + output_file.string());
+        }
+    }
+}
+
+} // namespace chess
@@ -0,0 +1,87 @@
+#include <chess_score_calculator/score_cache.hpp>
+////////////////////////////////////////////////////////////////////////////////
+// Standard Libraries
+#include <algorithm>
+#include <bit>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+/// Marks an occupied entry, as no score reaches 2^31 half points
+constexpr std::uint64_t occupied_flag = std::uint64_t { 1 } << 63;
+
+std::uint64_t encode(const chess::Score& score) noexcept
+{
+    // scores are multiples of a half, so twice the score is exact
+    const auto white_half_points = static_cast<std::uint64_t>(score.white * 2);
+    const auto black_half_points = static_cast<std::uint64_t>(score.black * 2);
+    return occupied_flag | (white_half_points << 32) | black_half_points;
+}
+
+chess::Score decode(std::uint64_t data) noexcept
+{
+    const auto white_half_points = static_cast<std::uint32_t>((data & ~occupied_flag) >> 32);
+    const auto black_half_points = static_cast<std::uint32_t>(data);
+    return chess::Score { white_half_points / 2.0, black_half_points / 2.0 };
+}
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace chess {
+
+ScoreCache::ScoreCache(size_t num_entries)
+    : entries(std::make_unique<Entry[]>(std::bit_ceil(std::max<size_t>(num_entries, 1))))
+    , index_mask(std::bit_ceil(std::max<size_t>(num_entries, 1)) - 1)
+{
+}
+
+std::optional<Score> ScoreCache::find(std::uint64_t hash) noexcept
+{
+    const Entry& entry = entries[hash & index_mask];
+    const std::uint64_t data = entry.data.load(std::memory_order_relaxed);
+    const std::uint64_t checked_hash = entry.checked_hash.load(std::memory_order_relaxed);
+    if ((data & occupied_flag) && ((checked_hash ^ data) == hash)) {
+        num_hits.fetch_add(1, std::memory_order_relaxed);
+        return decode(data);
+    }
+    num_misses.fetch_add(1, std::memory_order_relaxed);
+    return std::nullopt;
+}
+
+void ScoreCache::insert(std::uint64_t hash, const Score& score) noexcept
+{
+    Entry& entry = entries[hash & index_mask];
+    const std::uint64_t data = encode(score);
+    entry.checked_hash.store(hash ^ data, std::memory_order_relaxed);
+    entry.data.store(data, std::memory_order_relaxed);
+}
+
+Score ScoreCache::score(const Chessboard& chessboard)
+{
+    const std::uint64_t hash = chessboard.get_hash();
+    if (const std::optional<Score> cached_score = find(hash)) {
+        return *cached_score;
+    }
+    const Score result = chessboard.score();
+    insert(hash, result);
+    return result;
+}
+
+size_t ScoreCache::get_num_entries() const noexcept
+{
+    return index_mask + 1;
+}
+
+std::uint64_t ScoreCache::get_num_hits() const noexcept
+{
+    return num_hits.load(std::memory_order_relaxed);
+}
+
+std::uint64_t ScoreCache::get_num_misses() const noexcept
+{
+    return num_misses.load(std::memory_order_relaxed);
+}
+
+} // namespace chess
@@ -0,0 +1,389 @@
+#include <chess_score_calculator/score_server.hpp>
+////////////////////////////////////////////////////////////////////////////////
+// Standard Libraries
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <deque>
+#include <exception>
+#include <format>
+#include <iterator>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <utility>
+#ifdef __linux__
+#define CHESS_SCORE_CALCULATOR_HAS_EPOLL
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+/// Epoll user data of the sockets other than connections
+constexpr std::uint64_t listen_id = 0;
+constexpr std::uint64_t event_id = 1;
+
+/// A connection that sends this many bytes without completing a request is closed
+constexpr size_t max_request_size = 64 * 1024;
+
+/// A connection is not read while it has this many unwritten responses, or this many bytes the peer
+/// has not received, so a client that sends without reading cannot grow the memory of the server
+constexpr size_t max_pending_responses = 1024;
+constexpr size_t max_output_size = 256 * 1024;
+
+[[noreturn]] void throw_system_error(const std::string& what)
+{
+    throw std::system_error(errno, std::generic_category(), what);
+}
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace chess {
+
+struct ScoreServer::Connection {
+    std::uint64_t id;
+    int fd;
+    /// Bytes of the request being received
+    std::string input;
+    /// Responses of the submitted requests in order, empty until scored
+    std::deque<std::optional<std::string>> responses;
+    /// Sequence of the front of #responses
+    std::uint64_t first_sequence = 0;
+    /// Responses that are not yet accepted by the socket
+    std::string output;
+    /// Peer finished sending or the connection failed
+    bool is_read_closed = false;
+    bool has_failed = false;
+    /// Events currently registered at the epoll instance
+    std::uint32_t watched_events = 0;
+};
+
+ScoreServer::FileDescriptor::~FileDescriptor()
+{
+    reset(-1);
+}
+
+void ScoreServer::FileDescriptor::reset(int new_fd) noexcept
+{
+#ifdef CHESS_SCORE_CALCULATOR_HAS_EPOLL
+    if (fd != -1) {
+        ::close(fd);
+    }
+#endif
+    fd = new_fd;
+}
+
+Chessboard parse_request(std::string_view request)
+{
+    // FEN records separate the rows by slashes, board denotations by whitespace
+    if (request.find('/') != std::string_view::npos) {
+        return Chessboard::from_fen(request.substr(request.find_first_not_of(" \t\n")));
+    }
+    return Chessboard::from_string(request);
+}
+
+ScoreServer::ScoreServer(std::filesystem::path socket_path, ThreadPool& thread_pool, ScoreCache* score_cache)
+    : socket_path(std::move(socket_path))
+    , thread_pool(thread_pool)
+    , score_cache(score_cache)
+    , next_connection_id(event_id + 1)
+{
+#ifdef CHESS_SCORE_CALCULATOR_HAS_EPOLL
+    sockaddr_un address {};
+    address.sun_family = AF_UNIX;
+    const std::string& path = this->socket_path.native();
+    if (path.size() >= sizeof(address.sun_path)) {
+        throw std::invalid_argument("Socket path is too long: " + path);
+    }
+    std::memcpy(address.sun_path, path.c_str(), path.size() + 1);
+    // replace a socket left by a previous process, but never another kind of file
+    struct stat status;
+    if ((::stat(path.c_str(), &status) == 0) && S_ISSOCK(status.st_mode)) {
+        ::unlink(path.c_str());
+    }
+    listen_fd.reset(::socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0));
+    if (listen_fd.get() == -1) {
+        throw_system_error("Cannot create socket");
+    }
+    if (::bind(listen_fd.get(), reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0) {
+        throw_system_error("Cannot listen at " + path);
+    }
+    // the destructor does not run if the constructor throws, so the bound socket file is removed here,
+    // and the descriptors are closed by their owners
+    try {
+        if (::listen(listen_fd.get(), SOMAXCONN) != 0) {
+            throw_system_error("Cannot listen at " + path);
+        }
+        epoll_fd.reset(::epoll_create1(EPOLL_CLOEXEC));
+        if (epoll_fd.get() == -1) {
+            throw_system_error("Cannot create event loop");
+        }
+        event_fd.reset(::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC));
+        if (event_fd.get() == -1) {
+            throw_system_error("Cannot create event loop");
+        }
+        epoll_event listen_event { .events = EPOLLIN, .data = { .u64 = listen_id } };
+        epoll_event wake_event { .events = EPOLLIN, .data = { .u64 = event_id } };
+        if ((::epoll_ctl(epoll_fd.get(), EPOLL_CTL_ADD, listen_fd.get(), &listen_event) != 0) || (::epoll_ctl(epoll_fd.get(), EPOLL_CTL_ADD, event_fd.get(), &wake_event) != 0)) {
+            throw_system_error("Cannot create event loop");
+        }
+    } catch (...) {
+        ::unlink(path.c_str());
+        throw;
+    }
+#else
+    throw std::runtime_error("Server mode is only available on Linux");
+#endif
+}
+
+ScoreServer::~ScoreServer()
+{
+#ifdef CHESS_SCORE_CALCULATOR_HAS_EPOLL
+    // tasks refer to this instance
+    try {
+        thread_pool.wait();
+    } catch (const std::exception&) {
+        // tasks report their errors as responses, nothing is left to handle
+    }
+    while (!connections.empty()) {
+        close_connection(connections.begin()->first);
+    }
+    ::unlink(socket_path.c_str());
+#endif
+}
+
+void ScoreServer::run()
+{
+#ifdef CHESS_SCORE_CALCULATOR_HAS_EPOLL
+    std::array<epoll_event, 64> events;
+    while (!is_stopped.load()) {
+        const int num_events = ::epoll_wait(epoll_fd.get(), events.data(), static_cast<int>(events.size()), -1);
+        if (num_events == -1) {
+            if (errno == EINTR) {
+                continue;
+            }
+            throw_system_error("Event loop failed");
+        }
+        for (int i = 0; i < num_events; i++) {
+            const std::uint64_t id = events[i].data.u64;
+            if (id == listen_id) {
+                accept_connections();
+                continue;
+            }
+            if (id == event_id) {
+                std::uint64_t count = 0;
+                [[maybe_unused]] const ssize_t size = ::read(event_fd.get(), &count, sizeof(count));
+                collect_completions();
+                continue;
+            }
+            // the connection may be closed by an earlier event of the same batch
+            const auto it = connections.find(id);
+            if (it == connections.end()) {
+                continue;
+            }
+            Connection& connection = *it->second;
+            // a hang up means the peer closed both directions, so no response can be delivered, and the
+            // event would be reported by every wait, even while nothing else is watched
+            if (events[i].events & (EPOLLHUP | EPOLLERR)) {
+                close_connection(id);
+                continue;
+            }
+            if (events[i].events & EPOLLIN) {
+                read_requests(connection);
+            }
+            write_responses(connection);
+            update_connection(connection);
+        }
+    }
+#endif
+}
+
+void ScoreServer::stop() noexcept
+{
+    is_stopped.store(true);
+#ifdef CHESS_SCORE_CALCULATOR_HAS_EPOLL
+    const std::uint64_t count = 1;
+    [[maybe_unused]] const ssize_t size = ::write(event_fd.get(), &count, sizeof(count));
+#endif
+}
+
+void ScoreServer::accept_connections()
+{
+#ifdef CHESS_SCORE_CALCULATOR_HAS_EPOLL
+    while (true) {
+        const int fd = ::accept4(listen_fd.get(), nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+        if (fd == -1) {
+            // a failed accept only affects the peer that is being accepted
+            return;
+        }
+        const std::uint64_t id = next_connection_id++;
+        epoll_event event { .events = EPOLLIN, .data = { .u64 = id } };
+        if (::epoll_ctl(epoll_fd.get(), EPOLL_CTL_ADD, fd, &event) != 0) {
+            ::close(fd);
+            continue;
+        }
+        auto connection = std::make_unique<Connection>();
+        connection->id = id;
+        connection->fd = fd;
+        connection->watched_events = EPOLLIN;
+        connections.emplace(id, std::move(connection));
+    }
+#endif
+}
+
+void ScoreServer::read_requests(Connection& connection)
+{
+#ifdef CHESS_SCORE_CALCULATOR_HAS_EPOLL
+    std::array<char, 16 * 1024> buffer;
+    const ssize_t size = ::recv(connection.fd, buffer.data(), buffer.size(), 0);
+    if (size <= 0) {
+        if ((size == 0) || ((errno != EAGAIN) && (errno != EINTR))) {
+            connection.is_read_closed = true;
+        }
+        return;
+    }
+    // carriage returns are dropped, so that an empty line is always two line feeds
+    std::copy_if(buffer.begin(), buffer.begin() + size, std::back_inserter(connection.input), [](char ch) { return ch != '\r'; });
+    size_t start = 0;
+    while (true) {
+        start = std::min(connection.input.find_first_not_of('\n', start), connection.input.size());
+        const size_t end = connection.input.find("\n\n", start);
+        if (end == std::string::npos) {
+            break;
+        }
+        submit_request(connection, connection.input.substr(start, end + 1 - start));
+        start = end + 2;
+    }
+    connection.input.erase(0, start);
+    if (connection.input.size() > max_request_size) {
+        connection.has_failed = true;
+    }
+#endif
+}
+
+void ScoreServer::submit_request(Connection& connection, std::string request)
+{
+    const std::uint64_t sequence = connection.first_sequence + connection.responses.size();
+    connection.responses.emplace_back();
+    thread_pool.submit([this, connection_id = connection.id, sequence, request = std::move(request)] {
+        std::string response;
+        try {
+            const Chessboard chessboard = parse_request(request);
+            const Score score = score_cache ? score_cache->score(chessboard) : chessboard.score();
+            response = std::format("{} {}\n", score.white, score.black);
+        } catch (const std::exception& e) {
+            response = std::format("error: {}\n", e.what());
+        }
+        bool was_empty = false;
+        {
+            const std::lock_guard<std::mutex> lock(completions_mutex);
+            was_empty = completions.empty();
+            completions.push_back(Completion { connection_id, sequence, std::move(response) });
+        }
+        // the event loop drains every completion at once, so only the first one needs to wake it
+        if (was_empty) {
+#ifdef CHESS_SCORE_CALCULATOR_HAS_EPOLL
+            const std::uint64_t count = 1;
+            [[maybe_unused]] const ssize_t size = ::write(event_fd.get(), &count, sizeof(count));
+#endif
+        }
+    });
+}
+
+void ScoreServer::collect_completions()
+{
+    std::vector<Completion> collected;
+    {
+        const std::lock_guard<std::mutex> lock(completions_mutex);
+        collected.swap(completions);
+    }
+    std::vector<std::uint64_t> updated_ids;
+    for (Completion& completion : collected) {
+        // responses of closed connections are dropped
+        const auto it = connections.find(completion.connection_id);
+        if (it == connections.end()) {
+            continue;
+        }
+        Connection& connection = *it->second;
+        connection.responses[completion.sequence - connection.first_sequence] = std::move(completion.response);
+        updated_ids.push_back(completion.connection_id);
+    }
+    std::ranges::sort(updated_ids);
+    const auto [first, last] = std::ranges::unique(updated_ids);
+    updated_ids.erase(first, last);
+    for (const std::uint64_t id : updated_ids) {
+        Connection& connection = *connections.at(id);
+        write_responses(connection);
+        update_connection(connection);
+    }
+}
+
+void ScoreServer::write_responses(Connection& connection)
+{
+#ifdef CHESS_SCORE_CALCULATOR_HAS_EPOLL
+    while (!connection.responses.empty() && connection.responses.front()) {
+        connection.output += *connection.responses.front();
+        connection.responses.pop_front();
+        connection.first_sequence++;
+    }
+    while (!connection.output.empty() && !connection.has_failed) {
+        const ssize_t size = ::send(connection.fd, connection.output.data(), connection.output.size(), MSG_NOSIGNAL);
+        if (size == -1) {
+            if ((errno != EAGAIN) && (errno != EINTR)) {
+                connection.has_failed = true;
+            }
+            return;
+        }
+        connection.output.erase(0, static_cast<size_t>(size));
+    }
+#endif
+}
+
+void ScoreServer::update_connection(Connection& connection)
+{
+#ifdef CHESS_SCORE_CALCULATOR_HAS_EPOLL
+    const bool is_finished = connection.is_read_closed && connection.responses.empty() && connection.output.empty();
+    if (connection.has_failed || is_finished) {
+        close_connection(connection.id);
+        return;
+    }
+    // watch for writability only while output is left, and stop reading a closed peer or a backlogged
+    // connection until its responses are written
+    const bool is_backlogged = (connection.responses.size() >= max_pending_responses) || (connection.output.size() >= max_output_size);
+    const bool is_readable = !connection.is_read_closed && !is_backlogged;
+    const std::uint32_t events = (is_readable ? std::uint32_t { EPOLLIN } : 0u) | (connection.output.empty() ? 0u : std::uint32_t { EPOLLOUT });
+    if (events != connection.watched_events) {
+        epoll_event event { .events = events, .data = { .u64 = connection.id } };
+        if (::epoll_ctl(epoll_fd.get(), EPOLL_CTL_MOD, connection.fd, &event) != 0) {
+            close_connection(connection.id);
+            return;
+        }
+        connection.watched_events = events;
+    }
+#endif
+}
+
+void ScoreServer::close_connection(std::uint64_t connection_id) noexcept
+{
+#ifdef CHESS_SCORE_CALCULATOR_HAS_EPOLL
+    const auto it = connections.find(connection_id);
+    if (it == connections.end()) {
+        return;
+    }
+    ::epoll_ctl(epoll_fd.get(), EPOLL_CTL_DEL, it->second->fd, nullptr);
+    ::close(it->second->fd);
+    connections.erase(it);
+#endif
+}
+
+} // namespace chess
@@ -0,0 +1,160 @@
+#include <chess_score_calculator/sliding_attacks.hpp>
+////////////////////////////////////////////////////////////////////////////////
+// Standard Libraries
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <utility>
+#include <vector>
+#if defined(__BMI2__) || (defined(_MSC_VER) && defined(__AVX2__))
+#define CHESS_SCORE_CALCULATOR_HAS_PEXT
+#include <immintrin.h>
+#endif
+////////////////////////////////////////////////////////////////////////////////
+// User Defined Libraries
+#include <chess_score_calculator/bitboard.hpp>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+using chess::Bitboard;
+
+/// Directions that increase the bit index come first
+enum Direction {
+    North,
+    East,
+    NorthEast,
+    NorthWest,
+    South,
+    West,
+    SouthEast,
+    SouthWest,
+};
+
+constexpr std::array<std::pair<int, int>, 8> direction_distances = {
+    std::pair { 1, 0 },
+    std::pair { 0, 1 },
+    std::pair { 1, 1 },
+    std::pair { 1, -1 },
+    std::pair { -1, 0 },
+    std::pair { 0, -1 },
+    std::pair { -1, 1 },
+    std::pair { -1, -1 },
+};
+
+constexpr std::array bishop_directions = { NorthEast, NorthWest, SouthEast, SouthWest };
+constexpr std::array rook_directions = { North, East, South, West };
+
+/// Tiles from a bit index to the edge of the board, excluding the bit index itself
+constexpr std::array<std::array<Bitboard, 64>, 8> rays = [] {
+    std::array<std::array<Bitboard, 64>, 8> result {};
+    for (int direction = 0; direction < 8; direction++) {
+        const auto [row_up, col_right] = direction_distances[direction];
+        for (int square = 0; square < 64; square++) {
+            int row = square / 8 + row_up;
+            int col = square % 8 + col_right;
+            while ((0 <= row) && (row < 8) && (0 <= col) && (col < 8)) {
+                result[direction][square] |= Bitboard { 1 } << (row * 8 + col);
+                row += row_up;
+                col += col_right;
+            }
+        }
+    }
+    return result;
+}();
+
+/**
+Attacks along one direction by finding the nearest blocker with a single bit scan
+
+A sentinel bit is added at the far end of the board, whose ray at the same direction is empty.
+*/
+constexpr Bitboard get_ray_attacks(Direction direction, int square, Bitboard occupancy) noexcept
+{
+    const Bitboard ray = rays[direction][square];
+    const Bitboard blockers = ray & occupancy;
+    const int blocker = (direction < South)
+        ? std::countr_zero(blockers | (Bitboard { 1 } << 63))
+        : 63 - std::countl_zero(blockers | Bitboard { 1 });
+    return ray ^ rays[direction][blocker];
+}
+
+template <size_t N>
+constexpr Bitboard get_ray_attacks(const std::array<Direction, N>& directions, int square, Bitboard occupancy) noexcept
+{
+    Bitboard result = 0;
+    for (Direction direction : directions) {
+        result |= get_ray_attacks(direction, square, occupancy);
+    }
+    return result;
+}
+
+#ifdef CHESS_SCORE_CALCULATOR_HAS_PEXT
+
+/// Attacks of every relevant occupancy, indexed by the occupancy bits extracted by PEXT
+class PextTable {
+public:
+    template <size_t N>
+    explicit PextTable(const std::array<Direction, N>& directions)
+    {
+        for (int square = 0; square < 64; square++) {
+            // the last tile of a ray does not block anything
+            for (Direction direction : directions) {
+                const Bitboard ray = rays[direction][square];
+                const Bitboard edge = (direction < South) ? std::bit_floor(ray) : (ray & (~ray + 1));
+                masks[square] |= ray & ~edge;
+            }
+            offsets[square] = attacks.size();
+            const size_t num_occupancies = size_t { 1 } << std::popcount(masks[square]);
+            for (size_t index = 0; index < num_occupancies; index++) {
+                const Bitboard occupancy = _pdep_u64(index, masks[square]);
+                attacks.push_back(get_ray_attacks(directions, square, occupancy));
+            }
+        }
+    }
+
+    Bitboard operator()(int square, Bitboard occupancy) const noexcept
+    {
+        return attacks[offsets[square] + _pext_u64(occupancy, masks[square])];
+    }
+
+private:
+    std::array<Bitboard, 64> masks {};
+    std::array<size_t, 64> offsets {};
+    std::vector<Bitboard> attacks;
+};
+
+const PextTable bishop_table(bishop_directions);
+const PextTable rook_table(rook_directions);
+
+#endif // CHESS_SCORE_CALCULATOR_HAS_PEXT
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace chess {
+
+Bitboard get_bishop_attacks(int square, Bitboard occupancy) noexcept
+{
+#ifdef CHESS_SCORE_CALCULATOR_HAS_PEXT
+    return bishop_table(square, occupancy);
+#else
+    return get_ray_attacks(bishop_directions, square, occupancy);
+#endif
+}
+
+Bitboard get_rook_attacks(int square, Bitboard occupancy) noexcept
+{
+#ifdef CHESS_SCORE_CALCULATOR_HAS_PEXT
+    return rook_table(square, occupancy);
+#else
+    return get_ray_attacks(rook_directions, square, occupancy);
+#endif
+}
+
+Bitboard get_queen_attacks(int square, Bitboard occupancy) noexcept
+{
+    return get_bishop_attacks(square, occupancy) | get_rook_attacks(square, occupancy);
+}
+
+} // namespace chess
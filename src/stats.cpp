@@ -0,0 +1,401 @@
+#include <chess_score_calculator/stats.hpp>
+////////////////////////////////////////////////////////////////////////////////
+// Standard Libraries
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <format>
+#include <mutex>
+#include <new>
+#include <ostream>
+#include <string_view>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+using chess::stats::Counter;
+using chess::stats::num_counters;
+using chess::stats::num_phases;
+using chess::stats::Phase;
+
+constexpr std::array<std::string_view, num_counters> counter_names {
+    "boards",
+    "files",
+    "pieces",
+    "threats",
+    "allocations",
+    "allocated_bytes",
+};
+
+constexpr std::array<std::string_view, num_counters> counter_descriptions {
+    "Boards parsed or decoded",
+    "Files opened",
+    "Pieces of the parsed boards",
+    "Threatened pieces found",
+    "Calls of operator new",
+    "Bytes requested from operator new",
+};
+
+constexpr std::array<std::string_view, num_phases> phase_names {
+    "file_open",
+    "tokenize",
+    "piece_construction",
+    "pawn_threats",
+    "knight_threats",
+    "bishop_threats",
+    "rook_threats",
+    "queen_threats",
+    "king_threats",
+    "reduction",
+    "batch_scoring",
+};
+
+/**
+Counters of a single thread
+
+Only the owning thread writes them, so an increment is a relaxed load and store instead of a locked
+read-modify-write. They are atomic only so that the snapshot can read them while the thread runs.
+*/
+struct ThreadStats {
+    std::array<std::atomic<std::uint64_t>, num_counters> counters {};
+    std::array<std::atomic<std::uint64_t>, num_phases> calls {};
+    std::array<std::atomic<std::uint64_t>, num_phases> nanoseconds {};
+    /// Next thread of the registry
+    ThreadStats* next = nullptr;
+};
+
+void increment(std::atomic<std::uint64_t>& counter, std::uint64_t value) noexcept
+{
+    counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+}
+
+/**
+Counters of the running threads and the totals of the finished ones
+
+Threads are linked through their counters instead of a container, because registering must not
+allocate: the first allocation of a thread is what registers it.
+*/
+class Registry {
+public:
+    void add_thread(ThreadStats& thread_stats) noexcept
+    {
+        const std::lock_guard<std::mutex> lock(mutex);
+        thread_stats.next = first;
+        first = &thread_stats;
+    }
+
+    /// Keep the counters of a finishing thread in the totals
+    void remove_thread(ThreadStats& thread_stats) noexcept
+    {
+        const std::lock_guard<std::mutex> lock(mutex);
+        for (ThreadStats** link = &first; *link; link = &(*link)->next) {
+            if (*link == &thread_stats) {
+                *link = thread_stats.next;
+                break;
+            }
+        }
+        for (size_t i = 0; i < num_counters; i++) {
+            increment(finished.counters[i], thread_stats.counters[i].load(std::memory_order_relaxed));
+        }
+        for (size_t i = 0; i < num_phases; i++) {
+            increment(finished.calls[i], thread_stats.calls[i].load(std::memory_order_relaxed));
+            increment(finished.nanoseconds[i], thread_stats.nanoseconds[i].load(std::memory_order_relaxed));
+        }
+    }
+
+    chess::stats::Snapshot get_snapshot()
+    {
+        chess::stats::Snapshot result;
+        const auto add_to_result = [&result](const ThreadStats& thread_stats) {
+            for (size_t i = 0; i < num_counters; i++) {
+                result.counters[i] += thread_stats.counters[i].load(std::memory_order_relaxed);
+            }
+            for (size_t i = 0; i < num_phases; i++) {
+                result.calls[i] += thread_stats.calls[i].load(std::memory_order_relaxed);
+                result.nanoseconds[i] += thread_stats.nanoseconds[i].load(std::memory_order_relaxed);
+            }
+        };
+        const std::lock_guard<std::mutex> lock(mutex);
+        add_to_result(finished);
+        for (const ThreadStats* thread_stats = first; thread_stats; thread_stats = thread_stats->next) {
+            add_to_result(*thread_stats);
+        }
+        return result;
+    }
+
+private:
+    std::mutex mutex;
+    ThreadStats* first = nullptr;
+    ThreadStats finished;
+};
+
+/// Constructed at first use, so that it outlives every thread that registers
+Registry& get_registry() noexcept
+{
+    static Registry registry;
+    return registry;
+}
+
+/// Registers the counters of a thread during its lifetime
+class ThreadStatsHandle {
+public:
+    ThreadStatsHandle() noexcept
+    {
+        get_registry().add_thread(thread_stats);
+    }
+
+    ~ThreadStatsHandle()
+    {
+        get_registry().remove_thread(thread_stats);
+    }
+
+    ThreadStats thread_stats;
+};
+
+ThreadStats& get_thread_stats() noexcept
+{
+    thread_local ThreadStatsHandle handle;
+    return handle.thread_stats;
+}
+
+/// Innermost running timer of each thread
+thread_local chess::stats::ScopedTimer* current_timer = nullptr;
+
+/// @returns Average per board, 0 if no board is counted
+double per_board(std::uint64_t value, const chess::stats::Snapshot& snapshot) noexcept
+{
+    const std::uint64_t num_boards = snapshot.counters[static_cast<size_t>(Counter::Boards)];
+    return (num_boards == 0) ? 0.0 : static_cast<double>(value) / static_cast<double>(num_boards);
+}
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace chess::stats {
+
+std::string_view to_string(Counter counter) noexcept
+{
+    return counter_names[static_cast<size_t>(counter)];
+}
+
+std::string_view to_string(Phase phase) noexcept
+{
+    return phase_names[static_cast<size_t>(phase)];
+}
+
+Snapshot get_snapshot()
+{
+    return get_registry().get_snapshot();
+}
+
+void add(Counter counter, std::uint64_t value) noexcept
+{
+    increment(get_thread_stats().counters[static_cast<size_t>(counter)], value);
+}
+
+void add_time(Phase phase, std::uint64_t nanoseconds) noexcept
+{
+    ThreadStats& thread_stats = get_thread_stats();
+    increment(thread_stats.calls[static_cast<size_t>(phase)], 1);
+    increment(thread_stats.nanoseconds[static_cast<size_t>(phase)], nanoseconds);
+}
+
+ScopedTimer::ScopedTimer(Phase phase) noexcept
+    : phase(phase)
+    , start(std::chrono::steady_clock::now())
+    , parent(current_timer)
+{
+    current_timer = this;
+}
+
+ScopedTimer::~ScopedTimer()
+{
+    const auto elapsed = static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count());
+    add_time(phase, elapsed - nested_nanoseconds);
+    if (parent) {
+        parent->nested_nanoseconds += elapsed;
+    }
+    current_timer = parent;
+}
+
+void write_json(std::ostream& os, const Snapshot& snapshot)
+{
+    os << "{\n  \"counters\": {\n";
+    for (size_t i = 0; i < num_counters; i++) {
+        os << std::format("    \"{}\": {}{}\n", counter_names[i], snapshot.counters[i], (i + 1 < num_counters) ? "," : "");
+    }
+    os << "  },\n  \"per_board\": {\n";
+    // the board counter itself is skipped
+    for (size_t i = 1; i < num_counters; i++) {
+        os << std::format("    \"{}\": {:.3f}{}\n", counter_names[i], per_board(snapshot.counters[i], snapshot), (i + 1 < num_counters) ? "," : "");
+    }
+    os << "  },\n  \"phases\": {\n";
+    for (size_t i = 0; i < num_phases; i++) {
+        os << std::format("    \"{}\": {{ \"calls\": {}, \"nanoseconds\": {}, \"nanoseconds_per_board\": {:.1f} }}{}\n", phase_names[i],
+            snapshot.calls[i], snapshot.nanoseconds[i], per_board(snapshot.nanoseconds[i], snapshot), (i + 1 < num_phases) ? "," : "");
+    }
+    os << "  }\n}\n";
+}
+
+void write_prometheus(std::ostream& os, const Snapshot& snapshot)
+{
+    for (size_t i = 0; i < num_counters; i++) {
+        const std::string_view name = counter_names[i];
+        os << std::format("# HELP chess_score_calculator_{}_total {}\n", name, counter_descriptions[i]);
+        os << std::format("# TYPE chess_score_calculator_{}_total counter\n", name);
+        os << std::format("chess_score_calculator_{}_total {}\n", name, snapshot.counters[i]);
+    }
+    os << "# HELP chess_score_calculator_phase_calls_total Calls of each phase\n";
+    os << "# TYPE chess_score_calculator_phase_calls_total counter\n";
+    for (size_t i = 0; i < num_phases; i++) {
+        os << std::format("chess_score_calculator_phase_calls_total{{phase=\"{}\"}} {}\n", phase_names[i], snapshot.calls[i]);
+    }
+    os << "# HELP chess_score_calculator_phase_seconds_total Time of each phase, excluding nested phases\n";
+    os << "# TYPE chess_score_calculator_phase_seconds_total counter\n";
+    for (size_t i = 0; i < num_phases; i++) {
+        os << std::format("chess_score_calculator_phase_seconds_total{{phase=\"{}\"}} {:.9f}\n", phase_names[i], static_cast<double>(snapshot.nanoseconds[i]) / 1e9);
+    }
+}
+
+} // namespace chess::stats
+
+////////////////////////////////////////////////////////////////////////////////
+
+// allocations are counted by replacing every global allocation function, so that no allocation is made
+// by an implementation, e.g. of a sanitizer, that the replaced deallocation functions do not match
+
+void* operator new(std::size_t size)
+{
+    chess::stats::add(chess::stats::Counter::Allocations, 1);
+    chess::stats::add(chess::stats::Counter::AllocatedBytes, size);
+    while (true) {
+        if (void* pointer = std::malloc((size == 0) ? 1 : size)) {
+            return pointer;
+        }
+        const std::new_handler new_handler = std::get_new_handler();
+        if (!new_handler) {
+            throw std::bad_alloc();
+        }
+        new_handler();
+    }
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment)
+{
+    chess::stats::add(chess::stats::Counter::Allocations, 1);
+    chess::stats::add(chess::stats::Counter::AllocatedBytes, size);
+    // aligned_alloc requires the size to be a multiple of the alignment
+    const auto align = static_cast<std::size_t>(alignment);
+    const std::size_t aligned_size = (size + align - 1) / align * align;
+    while (true) {
+        if (void* pointer = std::aligned_alloc(align, (aligned_size == 0) ? align : aligned_size)) {
+            return pointer;
+        }
+        const std::new_handler new_handler = std::get_new_handler();
+        if (!new_handler) {
+            throw std::bad_alloc();
+        }
+        new_handler();
+    }
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    try {
+        return operator new(size);
+    } catch (const std::bad_alloc&) {
+        return nullptr;
+    }
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+    try {
+        return operator new(size, alignment);
+    } catch (const std::bad_alloc&) {
+        return nullptr;
+    }
+}
+
+void* operator new[](std::size_t size)
+{
+    return operator new(size);
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment)
+{
+    return operator new(size, alignment);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t& tag) noexcept
+{
+    return operator new(size, tag);
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t& tag) noexcept
+{
+    return operator new(size, alignment, tag);
+}
+
+void operator delete(void* pointer) noexcept
+{
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, std::size_t) noexcept
+{
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, std::align_val_t) noexcept
+{
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, std::size_t, std::align_val_t) noexcept
+{
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, const std::nothrow_t&) noexcept
+{
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, std::align_val_t, const std::nothrow_t&) noexcept
+{
+    std::free(pointer);
+}
+
+void operator delete[](void* pointer) noexcept
+{
+    std::free(pointer);
+}
+
+void operator delete[](void* pointer, std::size_t) noexcept
+{
+    std::free(pointer);
+}
+
+void operator delete[](void* pointer, std::align_val_t) noexcept
+{
+    std::free(pointer);
+}
+
+void operator delete[](void* pointer, std::size_t, std::align_val_t) noexcept
+{
+    std::free(pointer);
+}
+
+void operator delete[](void* pointer, const std::nothrow_t&) noexcept
+{
+    std::free(pointer);
+}
+
+void operator delete[](void* pointer, std::align_val_t, const std::nothrow_t&) noexcept
+{
+    std::free(pointer);
+}
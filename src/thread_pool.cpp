@@ -0,0 +1,142 @@
+#include <chess_score_calculator/thread_pool.hpp>
+////////////////////////////////////////////////////////////////////////////////
+// Standard Libraries
+#include <algorithm>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+/// Pool of the current worker thread, if any
+thread_local const chess::ThreadPool* current_pool = nullptr;
+
+/// Index of the current worker thread at its pool
+thread_local unsigned current_index = 0;
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace chess {
+
+ThreadPool::ThreadPool(unsigned num_threads)
+{
+    if (num_threads == 0) {
+        num_threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    workers.reserve(num_threads);
+    for (unsigned i = 0; i < num_threads; i++) {
+        workers.push_back(std::make_unique<Worker>());
+    }
+    threads.reserve(num_threads);
+    for (unsigned i = 0; i < num_threads; i++) {
+        threads.emplace_back(&ThreadPool::run, this, i);
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard lock(mutex);
+        stopping = true;
+    }
+    task_available.notify_all();
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+}
+
+unsigned ThreadPool::get_num_threads() const noexcept
+{
+    return static_cast<unsigned>(workers.size());
+}
+
+void ThreadPool::submit(std::function<void()> task)
+{
+    const unsigned index = (current_pool == this) ? current_index : (next_worker++ % get_num_threads());
+    // wait must not return before the task is finished, so count it before queueing
+    num_unfinished++;
+    {
+        Worker& worker = *workers[index];
+        std::lock_guard lock(worker.mutex);
+        worker.tasks.push_back(std::move(task));
+    }
+    // publish after the push, so a woken worker finds the task
+    num_queued++;
+    // a worker that is about to sleep has checked num_queued under the mutex, taking it orders the notification after its wait
+    if (num_sleeping != 0) {
+        std::lock_guard lock(mutex);
+    }
+    task_available.notify_one();
+}
+
+void ThreadPool::wait()
+{
+    std::unique_lock lock(mutex);
+    all_finished.wait(lock, [this] { return num_unfinished == 0; });
+    if (first_exception) {
+        std::rethrow_exception(std::exchange(first_exception, nullptr));
+    }
+}
+
+void ThreadPool::run(unsigned index)
+{
+    current_pool = this;
+    current_index = index;
+    while (true) {
+        std::function<void()> task;
+        if (try_pop(index, task)) {
+            try {
+                task();
+            } catch (...) {
+                std::lock_guard lock(mutex);
+                if (!first_exception) {
+                    first_exception = std::current_exception();
+                }
+            }
+            if (--num_unfinished == 0) {
+                std::lock_guard lock(mutex);
+                all_finished.notify_all();
+            }
+            continue;
+        }
+        std::unique_lock lock(mutex);
+        num_sleeping++;
+        task_available.wait(lock, [this] { return stopping || (num_queued > 0); });
+        num_sleeping--;
+        if (stopping && (num_queued <= 0)) {
+            return;
+        }
+    }
+}
+
+bool ThreadPool::try_pop(unsigned index, std::function<void()>& task)
+{
+    const unsigned num_threads = get_num_threads();
+    for (unsigned i = 0; i < num_threads; i++) {
+        const unsigned victim = (index + i) % num_threads;
+        Worker& worker = *workers[victim];
+        std::lock_guard worker_lock(worker.mutex);
+        if (worker.tasks.empty()) {
+            continue;
+        }
+        // own queue is used as a stack for locality, other queues are stolen from the opposite end
+        if (victim == index) {
+            task = std::move(worker.tasks.back());
+            worker.tasks.pop_back();
+        } else {
+            task = std::move(worker.tasks.front());
+            worker.tasks.pop_front();
+        }
+        num_queued--;
+        return true;
+    }
+    return false;
+}
+
+} // namespace chess
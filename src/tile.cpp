@@ -11,19 +11,20 @@ Tile::Tile(Coordinate coordinate) noexcept
 {
 }
 
-Tile::Tile(std::unique_ptr<Piece> piece) noexcept
-    : piece(std::move(piece))
+Tile::Tile(Piece piece) noexcept
+    : coordinate(piece.get_coordinate())
+    , piece(piece)
 {
 }
 
 bool Tile::has_piece() const noexcept
 {
-    return piece != nullptr;
+    return piece.has_value();
 }
 
 Coordinate Tile::get_coordinate() const noexcept
 {
-    return has_piece() ? piece->get_coordinate() : coordinate;
+    return coordinate;
 }
 
 Piece& Tile::get_piece() &
@@ -0,0 +1,97 @@
+////////////////////////////////////////////////////////////////////////////////
+// Standard Libraries
+#include <cerrno>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+////////////////////////////////////////////////////////////////////////////////
+// User Defined Libraries
+#include "test.hpp"
+#include <chess_score_calculator/batch_file_loader.hpp>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+const std::filesystem::path directory = std::filesystem::temp_directory_path() / "chess_score_calculator_batch_file_loader_test";
+constexpr size_t buffer_size = 256;
+
+/// Loaded file with its content, whose buffer is released
+struct LoadResult {
+    std::string content;
+    chess::LoadedFile loaded_file;
+};
+
+/// @returns Every file loaded by a loader, in batches of at most max_batch_size files
+std::vector<LoadResult> load_files(const std::vector<std::filesystem::path>& files, bool is_io_uring_requested, unsigned max_batch_size)
+{
+    chess::FileBufferPool buffer_pool(4, buffer_size);
+    chess::BatchFileLoader batch_file_loader(buffer_pool, max_batch_size, is_io_uring_requested);
+    if (is_io_uring_requested && !batch_file_loader.is_using_io_uring()) {
+        std::clog << "io_uring is not available, only the synchronous loader is tested\n";
+    }
+    std::vector<const std::filesystem::path*> file_pointers;
+    for (const std::filesystem::path& file : files) {
+        file_pointers.push_back(&file);
+    }
+    std::vector<LoadResult> result;
+    while (result.size() < files.size()) {
+        for (const chess::LoadedFile& loaded_file : batch_file_loader.load(std::span(file_pointers).subspan(result.size()))) {
+            const std::span<char> buffer = buffer_pool.get_buffer(loaded_file.buffer_id);
+            result.push_back(LoadResult { std::string(buffer.data(), loaded_file.size), loaded_file });
+            buffer_pool.release(loaded_file.buffer_id);
+        }
+    }
+    return result;
+}
+
+void test_loaders()
+{
+    std::filesystem::remove_all(directory);
+    std::filesystem::create_directories(directory / "subdirectory");
+    const std::string small_content = "ks -- --\n";
+    const std::string large_content(buffer_size * 3, 'x');
+    std::ofstream(directory / "small.txt", std::ios_base::binary) << small_content;
+    std::ofstream(directory / "large.txt", std::ios_base::binary) << large_content;
+    std::ofstream(directory / "empty.txt", std::ios_base::binary);
+    // more files than buffers and than the batch size, so that buffers are reused between batches
+    std::vector<std::filesystem::path> files;
+    for (int i = 0; i < 3; i++) {
+        files.push_back(directory / "small.txt");
+        files.push_back(directory / "missing.txt");
+        files.push_back(directory / "large.txt");
+        files.push_back(directory / "subdirectory");
+        files.push_back(directory / "empty.txt");
+    }
+    for (const unsigned max_batch_size : { 1u, 3u, 8u }) {
+        const std::vector<LoadResult> synchronous_results = load_files(files, false, max_batch_size);
+        const std::vector<LoadResult> io_uring_results = load_files(files, true, max_batch_size);
+        CHESS_SCORE_CALCULATOR_CHECK((synchronous_results.size() == files.size()) && (io_uring_results.size() == files.size()));
+        for (size_t i = 0; i < files.size(); i++) {
+            const LoadResult& expected = synchronous_results[i];
+            const LoadResult& actual = io_uring_results[i];
+            CHESS_SCORE_CALCULATOR_CHECK((actual.content == expected.content) && (actual.loaded_file.size == expected.loaded_file.size));
+            CHESS_SCORE_CALCULATOR_CHECK((actual.loaded_file.open_error == expected.loaded_file.open_error) && (actual.loaded_file.read_error == expected.loaded_file.read_error));
+        }
+        // a large file fills the buffer, a missing file fails to open and a directory fails to read
+        CHESS_SCORE_CALCULATOR_CHECK((synchronous_results[0].content == small_content) && (synchronous_results[0].loaded_file.open_error == 0) && (synchronous_results[0].loaded_file.read_error == 0));
+        CHESS_SCORE_CALCULATOR_CHECK(synchronous_results[1].loaded_file.open_error == ENOENT);
+        CHESS_SCORE_CALCULATOR_CHECK((synchronous_results[2].loaded_file.size == buffer_size) && (synchronous_results[2].content == large_content.substr(0, buffer_size)));
+        CHESS_SCORE_CALCULATOR_CHECK((synchronous_results[3].loaded_file.open_error == 0) && (synchronous_results[3].loaded_file.read_error == EISDIR));
+        CHESS_SCORE_CALCULATOR_CHECK(synchronous_results[4].content.empty() && (synchronous_results[4].loaded_file.read_error == 0));
+    }
+}
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////
+
+int main()
+{
+    const int result = chess::test::run(test_loaders);
+    std::filesystem::remove_all(directory);
+    return result;
+}
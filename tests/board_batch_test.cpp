@@ -0,0 +1,86 @@
+////////////////////////////////////////////////////////////////////////////////
+// Standard Libraries
+#include <random>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+////////////////////////////////////////////////////////////////////////////////
+// User Defined Libraries
+#include "test.hpp"
+#include <chess_score_calculator/board_batch.hpp>
+#include <chess_score_calculator/chessboard.hpp>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+using chess::BatchKernel;
+
+/// @returns Denotation of a board with each tile empty or holding a random piece, pawns never at the first or last row
+std::string generate_denotation(std::mt19937_64& random_engine)
+{
+    constexpr std::string_view piece_characters = "pafkvs";
+    constexpr std::string_view side_characters = "bs";
+    // sparse and crowded boards alike
+    const double occupancy = std::uniform_real_distribution<double>(0.05, 0.9)(random_engine);
+    std::string result;
+    for (int row = 7; row >= 0; row--) {
+        for (int col = 0; col < 8; col++) {
+            const bool is_occupied = std::bernoulli_distribution(occupancy)(random_engine);
+            const size_t first_piece = ((row == 0) || (row == 7)) ? 1 : 0;
+            const size_t piece = std::uniform_int_distribution<size_t>(first_piece, piece_characters.size() - 1)(random_engine);
+            result += is_occupied ? piece_characters[piece] : '-';
+            result += is_occupied ? side_characters[std::uniform_int_distribution<size_t>(0, 1)(random_engine)] : '-';
+            result += (col == 7) ? '\n' : ' ';
+        }
+    }
+    return result;
+}
+
+/// Every supported kernel must match Chessboard::score, including batches that do not fill the vector registers
+void test_kernels_match_score()
+{
+    std::mt19937_64 random_engine(1);
+    for (const size_t num_boards : { size_t { 1 }, size_t { 7 }, size_t { 16 }, size_t { 300 } }) {
+        chess::BoardBatch board_batch;
+        std::vector<chess::Score> expected_scores;
+        for (size_t i = 0; i < num_boards; i++) {
+            const chess::Chessboard chessboard = chess::Chessboard::from_string(generate_denotation(random_engine));
+            board_batch.push_back(chessboard);
+            expected_scores.push_back(chessboard.score());
+        }
+        for (const BatchKernel batch_kernel : { BatchKernel::Scalar, BatchKernel::Avx2, BatchKernel::Avx512 }) {
+            if (!chess::is_supported(batch_kernel)) {
+                std::cerr << "skipped unsupported kernel " << chess::to_string(batch_kernel) << std::endl;
+                continue;
+            }
+            std::vector<chess::Score> scores(num_boards);
+            chess::score_batch(board_batch, scores, batch_kernel);
+            for (size_t i = 0; i < num_boards; i++) {
+                CHESS_SCORE_CALCULATOR_CHECK((scores[i].white == expected_scores[i].white) && (scores[i].black == expected_scores[i].black));
+            }
+        }
+    }
+}
+
+void test_batch()
+{
+    chess::BoardBatch board_batch;
+    board_batch.push_back(chess::Chessboard::from_fen("4k3/8/8/8/8/8/8/4K2R"));
+    CHESS_SCORE_CALCULATOR_CHECK(board_batch.size() == 1);
+    std::vector<chess::Score> scores(2);
+    CHESS_SCORE_CALCULATOR_CHECK_THROWS(chess::score_batch(board_batch, scores));
+    CHESS_SCORE_CALCULATOR_CHECK(chess::is_supported(chess::get_batch_kernel()));
+    board_batch.clear();
+    CHESS_SCORE_CALCULATOR_CHECK(board_batch.size() == 0);
+    chess::score_batch(board_batch, std::span(scores).first(0));
+}
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////
+
+int main()
+{
+    return chess::test::run(test_kernels_match_score, test_batch);
+}
@@ -0,0 +1,87 @@
+////////////////////////////////////////////////////////////////////////////////
+// Standard Libraries
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <vector>
+////////////////////////////////////////////////////////////////////////////////
+// User Defined Libraries
+#include "test.hpp"
+#include <chess_score_calculator/board_file_list.hpp>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+void test_match_glob()
+{
+    using chess::match_glob;
+    CHESS_SCORE_CALCULATOR_CHECK(match_glob("*", ""));
+    CHESS_SCORE_CALCULATOR_CHECK(match_glob("*", "board.txt"));
+    CHESS_SCORE_CALCULATOR_CHECK(match_glob("*.txt", "board.txt"));
+    CHESS_SCORE_CALCULATOR_CHECK(!match_glob("*.txt", "board.txt.bak"));
+    CHESS_SCORE_CALCULATOR_CHECK(match_glob("board?.txt", "board1.txt"));
+    CHESS_SCORE_CALCULATOR_CHECK(!match_glob("board?.txt", "board.txt"));
+    CHESS_SCORE_CALCULATOR_CHECK(match_glob("*a*b*c", "xaybzc"));
+    CHESS_SCORE_CALCULATOR_CHECK(!match_glob("*a*b*c", "xaybz"));
+    // the star backtracks past an early partial match
+    CHESS_SCORE_CALCULATOR_CHECK(match_glob("*ab", "aab"));
+    CHESS_SCORE_CALCULATOR_CHECK(match_glob("board[123].txt", "board2.txt"));
+    CHESS_SCORE_CALCULATOR_CHECK(!match_glob("board[123].txt", "board4.txt"));
+    CHESS_SCORE_CALCULATOR_CHECK(match_glob("board[0-9].txt", "board7.txt"));
+    CHESS_SCORE_CALCULATOR_CHECK(!match_glob("board[0-9].txt", "boarda.txt"));
+    CHESS_SCORE_CALCULATOR_CHECK(match_glob("board[!0-9].txt", "boarda.txt"));
+    CHESS_SCORE_CALCULATOR_CHECK(!match_glob("board[!0-9].txt", "board7.txt"));
+    CHESS_SCORE_CALCULATOR_CHECK(!match_glob("board.txt", "Board.txt"));
+}
+
+void test_directory_file_list()
+{
+    const std::filesystem::path directory = std::filesystem::temp_directory_path() / "chess_score_calculator_board_file_list_test";
+    std::filesystem::remove_all(directory);
+    std::filesystem::create_directories(directory / "sub" / "deeper");
+    for (const std::filesystem::path& file : { directory / "a.txt", directory / "b.bin", directory / "sub" / "c.txt", directory / "sub" / "deeper" / "d.txt" }) {
+        std::ofstream ofs(file);
+    }
+    chess::DirectoryFileList file_list(directory, "*.txt");
+    std::vector<std::string> files;
+    while (const std::optional<std::filesystem::path> file = file_list.next()) {
+        files.push_back(file->lexically_relative(directory).generic_string());
+    }
+    // directory order is unspecified
+    std::ranges::sort(files);
+    CHESS_SCORE_CALCULATOR_CHECK(files == (std::vector<std::string> { "a.txt", "sub/c.txt", "sub/deeper/d.txt" }));
+    CHESS_SCORE_CALCULATOR_CHECK_THROWS(chess::DirectoryFileList(directory / "missing", "*"));
+    std::filesystem::remove_all(directory);
+}
+
+/// @returns Every path of a path list
+std::vector<std::string> read_path_list(const std::string& content)
+{
+    std::istringstream iss(content);
+    chess::PathListReader reader(iss);
+    std::vector<std::string> result;
+    while (const std::optional<std::filesystem::path> path = reader.next()) {
+        result.push_back(path->string());
+    }
+    return result;
+}
+
+void test_path_list_reader()
+{
+    CHESS_SCORE_CALCULATOR_CHECK(read_path_list("a.txt\n\nb c.txt\nd.txt") == (std::vector<std::string> { "a.txt", "b c.txt", "d.txt" }));
+    // a NUL before the first line feed makes the list NUL separated, so later names may hold line feeds
+    CHESS_SCORE_CALCULATOR_CHECK(read_path_list(std::string("a.txt\0b\nc.txt\0", 14)) == (std::vector<std::string> { "a.txt", "b\nc.txt" }));
+    CHESS_SCORE_CALCULATOR_CHECK(read_path_list("").empty());
+}
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////
+
+int main()
+{
+    return chess::test::run(test_match_glob, test_directory_file_list, test_path_list_reader);
+}
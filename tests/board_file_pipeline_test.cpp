@@ -0,0 +1,169 @@
+////////////////////////////////////////////////////////////////////////////////
+// Standard Libraries
+#include <array>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+////////////////////////////////////////////////////////////////////////////////
+// User Defined Libraries
+#include "test.hpp"
+#include <chess_score_calculator/board_file_pipeline.hpp>
+#include <chess_score_calculator/chessboard.hpp>
+#include <chess_score_calculator/result_cache.hpp>
+#include <chess_score_calculator/result_writer.hpp>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+const std::filesystem::path directory = std::filesystem::temp_directory_path() / "chess_score_calculator_board_file_pipeline_test";
+const std::filesystem::path output_file = directory / "result.csv";
+constexpr size_t num_board_files = 300;
+
+constexpr std::array<std::string_view, 3> denotations {
+    "ks as fs vs ss fs -- ks\n"
+    "ps ps -- -- ps ps -- ps\n"
+    "-- -- ps -- -- -- -- --\n"
+    "-- -- -- as -- -- ps --\n"
+    "vb -- -- pb -- fb -- pb\n"
+    "-- -- ab -- -- -- -- --\n"
+    "pb pb -- -- pb pb pb --\n"
+    "kb -- -- -- sb fb ab kb\n",
+    "-- -- -- -- ss -- -- --\n"
+    "-- -- -- -- -- -- -- --\n"
+    "-- -- -- -- -- -- -- --\n"
+    "-- -- -- -- -- -- -- --\n"
+    "-- -- -- -- -- -- -- --\n"
+    "-- -- -- -- -- -- -- --\n"
+    "-- -- -- -- -- -- -- --\n"
+    "-- -- -- -- sb -- -- kb\n",
+    "-- -- -- vs ss -- -- --\n"
+    "-- -- -- -- -- -- -- --\n"
+    "-- -- -- -- -- -- -- --\n"
+    "-- -- -- -- -- -- -- --\n"
+    "-- -- -- -- -- -- -- --\n"
+    "-- -- -- -- -- -- -- --\n"
+    "-- -- -- -- -- -- -- --\n"
+    "-- -- -- vb sb -- -- --\n",
+};
+
+std::filesystem::path get_board_path(size_t index)
+{
+    return directory / std::format("{:03}.txt", index);
+}
+
+/// Write the board files, cycling through the denotations
+void create_board_files()
+{
+    std::filesystem::remove_all(directory);
+    std::filesystem::create_directories(directory);
+    for (size_t i = 0; i < num_board_files; i++) {
+        std::ofstream ofs(get_board_path(i), std::ios_base::binary);
+        ofs << denotations[i % denotations.size()];
+    }
+}
+
+/// Tiny queues and batches, so every stage waits on its neighbours and the reorder window is small
+chess::PipelineOptions make_small_options()
+{
+    chess::PipelineOptions result;
+    result.queue_size = 2;
+    result.read_batch_size = 1;
+    return result;
+}
+
+/// @returns Rows of the output file without the header
+std::vector<std::string> read_rows()
+{
+    std::ifstream ifs(output_file);
+    std::vector<std::string> result;
+    std::string line;
+    std::getline(ifs, line);
+    while (std::getline(ifs, line)) {
+        result.push_back(line);
+    }
+    return result;
+}
+
+/// @returns Source of given board paths in order
+auto make_source(std::vector<std::filesystem::path> board_paths)
+{
+    return [board_paths = std::move(board_paths), next = size_t { 0 }]() mutable -> std::optional<std::filesystem::path> {
+        if (next == board_paths.size()) {
+            return std::nullopt;
+        }
+        return board_paths[next++];
+    };
+}
+
+std::vector<std::filesystem::path> get_board_paths()
+{
+    std::vector<std::filesystem::path> result;
+    for (size_t i = 0; i < num_board_files; i++) {
+        result.push_back(get_board_path(i));
+    }
+    return result;
+}
+
+void test_rows_in_input_order()
+{
+    create_board_files();
+    std::vector<std::string> expected_rows;
+    for (size_t i = 0; i < num_board_files; i++) {
+        const chess::Score score = chess::Chessboard::from_string(denotations[i % denotations.size()]).score();
+        expected_rows.push_back(std::format("{},{},{}", get_board_path(i).filename().string(), score.white, score.black));
+    }
+    for (const unsigned num_threads : { 1u, 3u, 8u }) {
+        {
+            chess::ResultWriter result_writer(chess::OutputFormat::Csv, 0, output_file, false);
+            chess::BoardFilePipeline pipeline(make_source(get_board_paths()), nullptr, make_small_options(), num_threads, nullptr);
+            pipeline.run(result_writer);
+            result_writer.close();
+            CHESS_SCORE_CALCULATOR_CHECK(pipeline.get_num_board_files() == num_board_files);
+        }
+        CHESS_SCORE_CALCULATOR_CHECK(read_rows() == expected_rows);
+    }
+}
+
+void test_result_cache()
+{
+    create_board_files();
+    for (size_t run = 0; run < 2; run++) {
+        chess::ResultCache result_cache(directory / "scores.cache");
+        chess::ResultWriter result_writer(chess::OutputFormat::Csv, 0, output_file, false);
+        chess::BoardFilePipeline pipeline(make_source(get_board_paths()), &result_cache, make_small_options(), 4, nullptr);
+        const auto entries = pipeline.run(result_writer);
+        result_writer.close();
+        CHESS_SCORE_CALCULATOR_CHECK(entries.size() == num_board_files);
+        // the second run finds every file unchanged
+        CHESS_SCORE_CALCULATOR_CHECK(pipeline.get_num_unchanged() == ((run == 0) ? 0 : num_board_files));
+        for (const auto& [key, entry] : entries) {
+            result_cache.insert(key, entry);
+        }
+        result_cache.save();
+    }
+}
+
+/// A missing file in the middle fails the run instead of hanging a stage
+void test_missing_file()
+{
+    create_board_files();
+    std::filesystem::remove(get_board_path(num_board_files / 2));
+    chess::ResultWriter result_writer(chess::OutputFormat::Csv, 0, output_file, false);
+    chess::BoardFilePipeline pipeline(make_source(get_board_paths()), nullptr, make_small_options(), 4, nullptr);
+    CHESS_SCORE_CALCULATOR_CHECK_THROWS(pipeline.run(result_writer));
+}
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////
+
+int main()
+{
+    const int result = chess::test::run(test_rows_in_input_order, test_result_cache, test_missing_file);
+    std::filesystem::remove_all(directory);
+    return result;
+}
@@ -0,0 +1,108 @@
+////////////////////////////////////////////////////////////////////////////////
+// Standard Libraries
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+////////////////////////////////////////////////////////////////////////////////
+// User Defined Libraries
+#include "test.hpp"
+#include <chess_score_calculator/board_reader.hpp>
+#include <chess_score_calculator/chessboard.hpp>
+#include <chess_score_calculator/enums.hpp>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+/// Board 1 of the README, whose scores are 134.5 and 133.5
+constexpr std::string_view board1_denotation = "ks as fs vs ss fs -- ks\n"
+                                               "ps ps -- -- ps ps -- ps\n"
+                                               "-- -- ps -- -- -- -- --\n"
+                                               "-- -- -- as -- -- ps --\n"
+                                               "vb -- -- pb -- fb -- pb\n"
+                                               "-- -- ab -- -- -- -- --\n"
+                                               "pb pb -- -- pb pb pb --\n"
+                                               "kb -- -- -- sb fb ab kb\n";
+
+constexpr std::string_view kings_denotation = "-- -- -- -- ss -- -- --\n"
+                                              "-- -- -- -- -- -- -- --\n"
+                                              "-- -- -- -- -- -- -- --\n"
+                                              "-- -- -- -- -- -- -- --\n"
+                                              "-- -- -- -- -- -- -- --\n"
+                                              "-- -- -- -- -- -- -- --\n"
+                                              "-- -- -- -- -- -- -- --\n"
+                                              "-- -- -- -- sb -- -- --\n";
+
+/// @returns Whether the board has the same pieces at the same tiles as the denotation
+bool is_same_board(const chess::Chessboard& chessboard, std::string_view denotation)
+{
+    const chess::Chessboard expected = chess::Chessboard::from_string(denotation);
+    bool result = true;
+    for (const chess::Side side : { chess::Side::White, chess::Side::Black }) {
+        result = result && (chessboard.get_bitboard(side) == expected.get_bitboard(side));
+    }
+    for (const chess::PieceType piece_type : { chess::PieceType::Pawn, chess::PieceType::Knight, chess::PieceType::Bishop, chess::PieceType::Rook, chess::PieceType::Queen, chess::PieceType::King }) {
+        result = result && (chessboard.get_bitboard(piece_type) == expected.get_bitboard(piece_type));
+    }
+    return result;
+}
+
+void test_ids()
+{
+    // IDs set by `#` lines, default IDs counting every board, blank lines between and around boards
+    std::istringstream iss("\n# first board \n" + std::string(board1_denotation) + "\n\n" + std::string(kings_denotation) + "#third\n\n" + std::string(kings_denotation) + "\n");
+    chess::BoardStreamReader reader(iss, "boards.txt");
+    const std::optional<chess::BoardRecord> first = reader.next();
+    CHESS_SCORE_CALCULATOR_CHECK(first && (first->id == "first board") && is_same_board(first->chessboard, board1_denotation));
+    const std::optional<chess::BoardRecord> second = reader.next();
+    CHESS_SCORE_CALCULATOR_CHECK(second && (second->id == "boards.txt:2") && is_same_board(second->chessboard, kings_denotation));
+    const std::optional<chess::BoardRecord> third = reader.next();
+    CHESS_SCORE_CALCULATOR_CHECK(third && (third->id == "third") && is_same_board(third->chessboard, kings_denotation));
+    CHESS_SCORE_CALCULATOR_CHECK(!reader.next());
+    CHESS_SCORE_CALCULATOR_CHECK(!reader.next());
+}
+
+void test_scores()
+{
+    std::istringstream iss { std::string(board1_denotation) };
+    chess::BoardStreamReader reader(iss, "board1.txt");
+    const std::optional<chess::BoardRecord> record = reader.next();
+    CHESS_SCORE_CALCULATOR_CHECK(record && (record->id == "board1.txt:1"));
+    if (record) {
+        const chess::Score score = record->chessboard.score();
+        CHESS_SCORE_CALCULATOR_CHECK((score.white == 134.5) && (score.black == 133.5));
+    }
+}
+
+void test_invalid_container()
+{
+    const std::string first_rows = std::string(kings_denotation.substr(0, 3 * 24));
+    // a board cut by the end of the container, or by the ID of the next board
+    std::istringstream incomplete(first_rows);
+    CHESS_SCORE_CALCULATOR_CHECK_THROWS(chess::BoardStreamReader(incomplete, "incomplete.txt").next());
+    std::istringstream interrupted(first_rows + "# next\n" + std::string(kings_denotation));
+    CHESS_SCORE_CALCULATOR_CHECK_THROWS(chess::BoardStreamReader(interrupted, "interrupted.txt").next());
+    // an ID without a board
+    std::istringstream missing_board(std::string(kings_denotation) + "# last\n\n");
+    chess::BoardStreamReader reader(missing_board, "missing.txt");
+    CHESS_SCORE_CALCULATOR_CHECK(reader.next().has_value());
+    CHESS_SCORE_CALCULATOR_CHECK_THROWS(reader.next());
+    // an invalid tile names the line of the board
+    std::istringstream invalid_tile("\n" + std::string(kings_denotation).replace(0, 2, "xx"));
+    try {
+        chess::BoardStreamReader(invalid_tile, "invalid.txt").next();
+        CHESS_SCORE_CALCULATOR_CHECK(false);
+    } catch (const std::invalid_argument& e) {
+        CHESS_SCORE_CALCULATOR_CHECK(std::string_view(e.what()).ends_with(" at line 2 of invalid.txt"));
+    }
+}
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////
+
+int main()
+{
+    return chess::test::run(test_ids, test_scores, test_invalid_container);
+}
@@ -0,0 +1,97 @@
+////////////////////////////////////////////////////////////////////////////////
+// Standard Libraries
+#include <atomic>
+#include <cstdint>
+#include <optional>
+#include <thread>
+#include <vector>
+////////////////////////////////////////////////////////////////////////////////
+// User Defined Libraries
+#include "test.hpp"
+#include <chess_score_calculator/bounded_queue.hpp>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+void test_single_thread()
+{
+    // the capacity is rounded up to a power of two
+    chess::BoundedQueue<int> queue(3);
+    for (int i = 0; i < 4; i++) {
+        CHESS_SCORE_CALCULATOR_CHECK(queue.try_push(i));
+    }
+    int rejected = 4;
+    CHESS_SCORE_CALCULATOR_CHECK(!queue.try_push(rejected));
+    // values come out in order, and the queue keeps working after wrapping around
+    for (int lap = 0; lap < 3; lap++) {
+        for (int i = 0; i < 4; i++) {
+            const std::optional<int> value = queue.try_pop();
+            CHESS_SCORE_CALCULATOR_CHECK(value && (*value == i));
+            queue.push(i);
+        }
+    }
+    queue.close();
+    for (int i = 0; i < 4; i++) {
+        CHESS_SCORE_CALCULATOR_CHECK(queue.pop() == i);
+    }
+    CHESS_SCORE_CALCULATOR_CHECK(!queue.pop());
+    CHESS_SCORE_CALCULATOR_CHECK(!queue.try_pop());
+}
+
+/// Producers and consumers block on a small queue, every value must be popped exactly once
+void test_multiple_threads()
+{
+    constexpr int num_producers = 4;
+    constexpr int num_consumers = 4;
+    constexpr std::uint64_t values_per_producer = 20000;
+    chess::BoundedQueue<std::uint64_t> queue(8);
+    std::vector<std::atomic<int>> pop_counts(num_producers * values_per_producer);
+    std::atomic<int> num_finished_producers = 0;
+    std::vector<std::thread> threads;
+    for (int producer = 0; producer < num_producers; producer++) {
+        threads.emplace_back([&, producer] {
+            for (std::uint64_t i = 0; i < values_per_producer; i++) {
+                queue.push(producer * values_per_producer + i);
+            }
+            // the last producer closes the queue, as the pipeline stages do
+            if (++num_finished_producers == num_producers) {
+                queue.close();
+            }
+        });
+    }
+    std::vector<bool> is_ordered(num_consumers, true);
+    for (int consumer = 0; consumer < num_consumers; consumer++) {
+        threads.emplace_back([&, consumer] {
+            // values of each producer are popped in the order they are pushed
+            std::vector<std::optional<std::uint64_t>> last_values(num_producers);
+            while (const std::optional<std::uint64_t> value = queue.pop()) {
+                pop_counts[*value]++;
+                std::optional<std::uint64_t>& last_value = last_values[*value / values_per_producer];
+                if (last_value && (*last_value >= *value)) {
+                    is_ordered[consumer] = false;
+                }
+                last_value = *value;
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    bool is_each_popped_once = true;
+    for (const std::atomic<int>& pop_count : pop_counts) {
+        is_each_popped_once = is_each_popped_once && (pop_count == 1);
+    }
+    CHESS_SCORE_CALCULATOR_CHECK(is_each_popped_once);
+    for (int consumer = 0; consumer < num_consumers; consumer++) {
+        CHESS_SCORE_CALCULATOR_CHECK(is_ordered[consumer]);
+    }
+}
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////
+
+int main()
+{
+    return chess::test::run(test_single_thread, test_multiple_threads);
+}
@@ -0,0 +1,133 @@
+////////////////////////////////////////////////////////////////////////////////
+// Standard Libraries
+#include <cstdint>
+#include <optional>
+#include <random>
+#include <string_view>
+#include <vector>
+////////////////////////////////////////////////////////////////////////////////
+// User Defined Libraries
+#include "test.hpp"
+#include <chess_score_calculator/bitboard.hpp>
+#include <chess_score_calculator/chessboard.hpp>
+#include <chess_score_calculator/enums.hpp>
+#include <chess_score_calculator/move_generator.hpp>
+#include <chess_score_calculator/packed_board.hpp>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+using chess::Chessboard;
+using chess::Move;
+using chess::PieceType;
+using chess::Side;
+
+/// @returns Coordinate of a tile name such as `e4`
+chess::Coordinate at(std::string_view tile)
+{
+    return chess::to_coordinate(((tile[1] - '1') * 8) + (tile[0] - 'a'));
+}
+
+/// Board state that make_move and unmake_move must keep consistent
+struct Snapshot {
+    chess::Bitboard white;
+    chess::Bitboard black;
+    std::uint64_t hash;
+    chess::Score score;
+
+    explicit Snapshot(const Chessboard& chessboard)
+        : white(chessboard.get_bitboard(Side::White))
+        , black(chessboard.get_bitboard(Side::Black))
+        , hash(chessboard.get_hash())
+        , score(chessboard.score())
+    {
+    }
+
+    friend bool operator==(const Snapshot& lhs, const Snapshot& rhs) noexcept
+    {
+        return (lhs.white == rhs.white) && (lhs.black == rhs.black) && (lhs.hash == rhs.hash) && (lhs.score.white == rhs.score.white) && (lhs.score.black == rhs.score.black);
+    }
+};
+
+/// @returns Whether the incrementally updated board equals the board rebuilt from its placement
+bool is_consistent(const Chessboard& chessboard)
+{
+    return Snapshot(chessboard) == Snapshot(Chessboard::from_packed(chess::pack(chessboard)));
+}
+
+void test_special_moves()
+{
+    struct Case {
+        std::string_view fen;
+        Move move;
+        std::string_view expected_fen;
+    };
+    const std::vector<Case> cases {
+        { "4k3/P7/8/8/8/8/8/4K3", Move { at("a7"), at("a8"), PieceType::Queen, false, false }, "Q3k3/8/8/8/8/8/8/4K3" },
+        { "1n2k3/P7/8/8/8/8/8/4K3", Move { at("a7"), at("b8"), PieceType::Knight, false, false }, "1N2k3/8/8/8/8/8/8/4K3" },
+        { "4k3/8/8/3pP3/8/8/8/4K3", Move { at("e5"), at("d6"), std::nullopt, true, false }, "4k3/8/3P4/8/8/8/8/4K3" },
+        { "4k3/8/8/8/3Pp3/8/8/4K3", Move { at("e4"), at("d3"), std::nullopt, true, false }, "4k3/8/8/8/8/3p4/8/4K3" },
+        { "r3k2r/8/8/8/8/8/8/R3K2R", Move { at("e1"), at("g1"), std::nullopt, false, true }, "r3k2r/8/8/8/8/8/8/R4RK1" },
+        { "r3k2r/8/8/8/8/8/8/R3K2R", Move { at("e8"), at("c8"), std::nullopt, false, true }, "2kr3r/8/8/8/8/8/8/R3K2R" },
+    };
+    for (const Case& test_case : cases) {
+        Chessboard chessboard = Chessboard::from_fen(test_case.fen);
+        const Snapshot before(chessboard);
+        chessboard.make_move(test_case.move);
+        CHESS_SCORE_CALCULATOR_CHECK(Snapshot(chessboard) == Snapshot(Chessboard::from_fen(test_case.expected_fen)));
+        chessboard.unmake_move();
+        CHESS_SCORE_CALCULATOR_CHECK(Snapshot(chessboard) == before);
+    }
+}
+
+void test_invalid_moves()
+{
+    Chessboard chessboard = Chessboard::from_fen("4k3/8/8/8/8/8/8/4K2R");
+    CHESS_SCORE_CALCULATOR_CHECK_THROWS(chessboard.unmake_move());
+    // an empty source, a target of the same side, en passant without a pawn behind the target
+    CHESS_SCORE_CALCULATOR_CHECK_THROWS(chessboard.make_move(at("a1"), at("a2")));
+    CHESS_SCORE_CALCULATOR_CHECK_THROWS(chessboard.make_move(at("h1"), at("e1")));
+    CHESS_SCORE_CALCULATOR_CHECK_THROWS(chessboard.make_move(Move { at("e1"), at("d2"), std::nullopt, true, false }));
+    CHESS_SCORE_CALCULATOR_CHECK(is_consistent(chessboard));
+}
+
+/// Random walks over the generated moves, every position must match a rebuilt board and unmaking must restore each one
+void test_random_walks()
+{
+    constexpr int num_walks = 50;
+    constexpr int walk_length = 40;
+    std::mt19937_64 random_engine(1);
+    for (int walk = 0; walk < num_walks; walk++) {
+        Chessboard chessboard = Chessboard::from_fen("rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR");
+        // half of the walks start with a cached board, the others build the cache at their first move
+        if (walk % 2 == 0) {
+            chessboard.build_attack_cache();
+        }
+        std::vector<Snapshot> history;
+        Side side = Side::White;
+        for (int ply = 0; ply < walk_length; ply++) {
+            const std::vector<Move> moves = chess::generate_moves(chessboard, side);
+            if (moves.empty()) {
+                break;
+            }
+            history.emplace_back(chessboard);
+            chessboard.make_move(moves[std::uniform_int_distribution<size_t>(0, moves.size() - 1)(random_engine)]);
+            CHESS_SCORE_CALCULATOR_CHECK(is_consistent(chessboard));
+            side = chess::get_opposite_side(side);
+        }
+        while (!history.empty()) {
+            chessboard.unmake_move();
+            CHESS_SCORE_CALCULATOR_CHECK(Snapshot(chessboard) == history.back());
+            history.pop_back();
+        }
+    }
+}
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////
+
+int main()
+{
+    return chess::test::run(test_special_moves, test_invalid_moves, test_random_walks);
+}
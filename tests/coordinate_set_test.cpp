@@ -0,0 +1,90 @@
+////////////////////////////////////////////////////////////////////////////////
+// Standard Libraries
+#include <algorithm>
+#include <iterator>
+#include <random>
+#include <set>
+#include <vector>
+////////////////////////////////////////////////////////////////////////////////
+// User Defined Libraries
+#include "test.hpp"
+#include <chess_score_calculator/bitboard.hpp>
+#include <chess_score_calculator/chessboard.hpp>
+#include <chess_score_calculator/coordinate_set.hpp>
+#include <chess_score_calculator/enums.hpp>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+using chess::Column;
+using chess::Coordinate;
+using chess::CoordinateSet;
+using chess::Row;
+
+/// @returns Coordinates in iteration order
+std::vector<Coordinate> to_vector(const CoordinateSet& coordinates)
+{
+    return std::vector<Coordinate>(coordinates.begin(), coordinates.end());
+}
+
+void test_basics()
+{
+    CoordinateSet coordinates { Coordinate { Row::_8, Column::h }, Coordinate { Row::_1, Column::b }, Coordinate { Row::_1, Column::a }, Coordinate { Row::_2, Column::a } };
+    // ascending order is row first, then column, as in std::set
+    CHESS_SCORE_CALCULATOR_CHECK(to_vector(coordinates) == (std::vector<Coordinate> { { Row::_1, Column::a }, { Row::_1, Column::b }, { Row::_2, Column::a }, { Row::_8, Column::h } }));
+    CHESS_SCORE_CALCULATOR_CHECK((coordinates.size() == 4) && !coordinates.empty());
+    CHESS_SCORE_CALCULATOR_CHECK(coordinates.contains(Coordinate { Row::_8, Column::h }) && !coordinates.contains(Coordinate { Row::_8, Column::g }));
+    coordinates.insert(Coordinate { Row::_1, Column::a });
+    CHESS_SCORE_CALCULATOR_CHECK(coordinates.size() == 4);
+    coordinates.erase(Coordinate { Row::_8, Column::h });
+    coordinates.erase(Coordinate { Row::_8, Column::h });
+    CHESS_SCORE_CALCULATOR_CHECK(coordinates.size() == 3);
+    CHESS_SCORE_CALCULATOR_CHECK(CoordinateSet().empty() && (CoordinateSet().begin() == CoordinateSet().end()));
+    CHESS_SCORE_CALCULATOR_CHECK(CoordinateSet(~chess::Bitboard { 0 }).size() == 64);
+}
+
+/// Random sets must behave as std::set with the standard set algorithms
+void test_against_std_set()
+{
+    std::mt19937_64 random_engine(12345);
+    for (int i = 0; i < 1000; i++) {
+        // sparse and dense sets
+        const chess::Bitboard lhs_bitboard = random_engine() & random_engine();
+        const chess::Bitboard rhs_bitboard = random_engine() | random_engine();
+        const CoordinateSet lhs(lhs_bitboard);
+        const CoordinateSet rhs(rhs_bitboard);
+        const std::set<Coordinate> lhs_set = lhs;
+        const std::set<Coordinate> rhs_set = rhs;
+        CHESS_SCORE_CALCULATOR_CHECK(std::ranges::equal(lhs, lhs_set) && (lhs.size() == lhs_set.size()));
+        std::set<Coordinate> expected;
+        std::ranges::set_union(lhs_set, rhs_set, std::inserter(expected, expected.end()));
+        CHESS_SCORE_CALCULATOR_CHECK(static_cast<std::set<Coordinate>>(lhs | rhs) == expected);
+        expected.clear();
+        std::ranges::set_intersection(lhs_set, rhs_set, std::inserter(expected, expected.end()));
+        CHESS_SCORE_CALCULATOR_CHECK(static_cast<std::set<Coordinate>>(lhs & rhs) == expected);
+        expected.clear();
+        std::ranges::set_difference(lhs_set, rhs_set, std::inserter(expected, expected.end()));
+        CHESS_SCORE_CALCULATOR_CHECK(static_cast<std::set<Coordinate>>(lhs - rhs) == expected);
+        CHESS_SCORE_CALCULATOR_CHECK((lhs - rhs) == CoordinateSet(lhs_bitboard & ~rhs_bitboard));
+    }
+}
+
+void test_chessboard_queries()
+{
+    const chess::Chessboard chessboard = chess::Chessboard::from_fen("4k3/8/8/8/8/8/4r3/4K2R");
+    const std::set<Coordinate> white = chessboard.get_white_piece_coordinates();
+    CHESS_SCORE_CALCULATOR_CHECK(white == (std::set<Coordinate> { { Row::_1, Column::e }, { Row::_1, Column::h } }));
+    // the king threatens the rook, which threatens the king
+    CHESS_SCORE_CALCULATOR_CHECK(chessboard.get_threatened_black_piece_coordinates() == (CoordinateSet { Coordinate { Row::_2, Column::e } }));
+    CHESS_SCORE_CALCULATOR_CHECK(chessboard.get_threatened_white_piece_coordinates() == (CoordinateSet { Coordinate { Row::_1, Column::e } }));
+    CHESS_SCORE_CALCULATOR_CHECK((chessboard.get_white_piece_coordinates() | chessboard.get_black_piece_coordinates()) == chessboard.get_all_piece_coordinates());
+}
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////
+
+int main()
+{
+    return chess::test::run(test_basics, test_against_std_set, test_chessboard_queries);
+}
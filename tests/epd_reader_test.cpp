@@ -0,0 +1,93 @@
+////////////////////////////////////////////////////////////////////////////////
+// Standard Libraries
+#include <optional>
+#include <string_view>
+////////////////////////////////////////////////////////////////////////////////
+// User Defined Libraries
+#include "test.hpp"
+#include <chess_score_calculator/chessboard.hpp>
+#include <chess_score_calculator/enums.hpp>
+#include <chess_score_calculator/epd_reader.hpp>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+/// Board 1 of the README, whose scores are 134.5 and 133.5
+constexpr std::string_view board1_denotation = "ks as fs vs ss fs -- ks\n"
+                                               "ps ps -- -- ps ps -- ps\n"
+                                               "-- -- ps -- -- -- -- --\n"
+                                               "-- -- -- as -- -- ps --\n"
+                                               "vb -- -- pb -- fb -- pb\n"
+                                               "-- -- ab -- -- -- -- --\n"
+                                               "pb pb -- -- pb pb pb --\n"
+                                               "kb -- -- -- sb fb ab kb\n";
+constexpr std::string_view board1_fen = "rnbqkb1r/pp2pp1p/2p5/3n2p1/Q2P1B1P/2N5/PP2PPP1/R3KBNR";
+
+/// @returns Whether both boards have the same pieces at the same tiles
+bool is_same_board(const chess::Chessboard& lhs, const chess::Chessboard& rhs)
+{
+    bool result = true;
+    for (const chess::Side side : { chess::Side::White, chess::Side::Black }) {
+        result = result && (lhs.get_bitboard(side) == rhs.get_bitboard(side));
+    }
+    for (const chess::PieceType piece_type : { chess::PieceType::Pawn, chess::PieceType::Knight, chess::PieceType::Bishop, chess::PieceType::Rook, chess::PieceType::Queen, chess::PieceType::King }) {
+        result = result && (lhs.get_bitboard(piece_type) == rhs.get_bitboard(piece_type));
+    }
+    return result;
+}
+
+void test_fen_matches_denotation()
+{
+    const chess::Chessboard from_fen = chess::Chessboard::from_fen(board1_fen);
+    const chess::Chessboard from_string = chess::Chessboard::from_string(board1_denotation);
+    CHESS_SCORE_CALCULATOR_CHECK(is_same_board(from_fen, from_string));
+    const chess::Score score = from_fen.score();
+    CHESS_SCORE_CALCULATOR_CHECK(score.white == 134.5);
+    CHESS_SCORE_CALCULATOR_CHECK(score.black == 133.5);
+}
+
+void test_invalid_fen()
+{
+    // a row of 9 tiles, a row of 7 tiles, 7 rows, an unknown piece
+    CHESS_SCORE_CALCULATOR_CHECK_THROWS(chess::Chessboard::from_fen("rnbqkbnr1/8/8/8/8/8/8/RNBQKBNR"));
+    CHESS_SCORE_CALCULATOR_CHECK_THROWS(chess::Chessboard::from_fen("rnbqkbn/8/8/8/8/8/8/RNBQKBNR"));
+    CHESS_SCORE_CALCULATOR_CHECK_THROWS(chess::Chessboard::from_fen("8/8/8/8/8/8/RNBQKBNR"));
+    CHESS_SCORE_CALCULATOR_CHECK_THROWS(chess::Chessboard::from_fen("xnbqkbnr/8/8/8/8/8/8/RNBQKBNR"));
+}
+
+void test_epd_records()
+{
+    const std::string_view epd = "# comment\n"
+                                 "\n"
+                                 "rnbqkb1r/pp2pp1p/2p5/3n2p1/Q2P1B1P/2N5/PP2PPP1/R3KBNR b KQkq - bm Nb6; id \"board 1\";\n"
+                                 "4k3/8/8/8/8/8/8/4K3\r\n"
+                                 "4k3/8/8/8/8/8/8/4K3 w - - 0 1\n";
+    chess::EpdReader reader(epd);
+    const std::optional<chess::EpdRecord> first = reader.next();
+    CHESS_SCORE_CALCULATOR_CHECK(first && (first->id == "board 1") && (first->line_number == 3) && (first->side_to_move == chess::Side::Black));
+    CHESS_SCORE_CALCULATOR_CHECK(first && is_same_board(first->chessboard, chess::Chessboard::from_fen(board1_fen)));
+    // the carriage return is whitespace, the fields after the placement are optional
+    const std::optional<chess::EpdRecord> second = reader.next();
+    CHESS_SCORE_CALCULATOR_CHECK(second && second->id.empty() && (second->line_number == 4) && (second->side_to_move == chess::Side::White));
+    const std::optional<chess::EpdRecord> third = reader.next();
+    CHESS_SCORE_CALCULATOR_CHECK(third && (third->line_number == 5));
+    CHESS_SCORE_CALCULATOR_CHECK(!reader.next());
+}
+
+void test_invalid_epd()
+{
+    chess::EpdReader invalid_side("4k3/8/8/8/8/8/8/4K3 x\n");
+    CHESS_SCORE_CALCULATOR_CHECK_THROWS(invalid_side.next());
+    chess::EpdReader invalid_placement("4k3/8/8/8/8/8/8/4K3\n4k4/8/8/8/8/8/8/4K3\n");
+    CHESS_SCORE_CALCULATOR_CHECK(invalid_placement.next());
+    CHESS_SCORE_CALCULATOR_CHECK_THROWS(invalid_placement.next());
+}
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////
+
+int main()
+{
+    return chess::test::run(test_fen_matches_denotation, test_invalid_fen, test_epd_records, test_invalid_epd);
+}
@@ -0,0 +1,75 @@
+////////////////////////////////////////////////////////////////////////////////
+// Standard Libraries
+#include <filesystem>
+#include <fstream>
+#include <string_view>
+#include <utility>
+////////////////////////////////////////////////////////////////////////////////
+// User Defined Libraries
+#include "test.hpp"
+#include <chess_score_calculator/mapped_file.hpp>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+const std::filesystem::path directory = std::filesystem::temp_directory_path() / "chess_score_calculator_mapped_file_test";
+
+void write_file(const std::filesystem::path& file, std::string_view content)
+{
+    std::ofstream ofs(file, std::ios_base::binary);
+    ofs << content;
+}
+
+void test_content()
+{
+    const std::filesystem::path file = directory / "board.txt";
+    write_file(file, std::string_view("ks -- --\n\0binary", 16));
+    const chess::MappedFile mapped_file(file);
+    CHESS_SCORE_CALCULATOR_CHECK(mapped_file.get_view() == std::string_view("ks -- --\n\0binary", 16));
+    CHESS_SCORE_CALCULATOR_CHECK(mapped_file.get_data().size() == 16);
+}
+
+void test_empty_file()
+{
+    const std::filesystem::path file = directory / "empty.txt";
+    write_file(file, "");
+    const chess::MappedFile mapped_file(file);
+    CHESS_SCORE_CALCULATOR_CHECK(mapped_file.get_view().empty() && mapped_file.get_data().empty());
+}
+
+void test_invalid_file()
+{
+    CHESS_SCORE_CALCULATOR_CHECK_THROWS(chess::MappedFile(directory / "missing.txt"));
+    CHESS_SCORE_CALCULATOR_CHECK_THROWS(chess::MappedFile(directory));
+}
+
+void test_move()
+{
+    write_file(directory / "a.txt", "first");
+    write_file(directory / "b.txt", "second");
+    chess::MappedFile a(directory / "a.txt");
+    chess::MappedFile moved(std::move(a));
+    CHESS_SCORE_CALCULATOR_CHECK(moved.get_view() == "first");
+    CHESS_SCORE_CALCULATOR_CHECK(a.get_view().empty());
+    chess::MappedFile b(directory / "b.txt");
+    // the mapping of the assigned file is released, and the moved one is kept
+    moved = std::move(b);
+    CHESS_SCORE_CALCULATOR_CHECK(moved.get_view() == "second");
+    CHESS_SCORE_CALCULATOR_CHECK(b.get_view().empty());
+    // the view outlives removing the file
+    std::filesystem::remove(directory / "b.txt");
+    CHESS_SCORE_CALCULATOR_CHECK(moved.get_view() == "second");
+}
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////
+
+int main()
+{
+    std::filesystem::remove_all(directory);
+    std::filesystem::create_directories(directory);
+    const int result = chess::test::run(test_content, test_empty_file, test_invalid_file, test_move);
+    std::filesystem::remove_all(directory);
+    return result;
+}
@@ -0,0 +1,124 @@
+////////////////////////////////////////////////////////////////////////////////
+// Standard Libraries
+#include <algorithm>
+#include <optional>
+#include <utility>
+#include <vector>
+////////////////////////////////////////////////////////////////////////////////
+// User Defined Libraries
+#include "test.hpp"
+#include <chess_score_calculator/chessboard.hpp>
+#include <chess_score_calculator/enums.hpp>
+#include <chess_score_calculator/move_evaluator.hpp>
+#include <chess_score_calculator/move_generator.hpp>
+#include <chess_score_calculator/packed_board.hpp>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+using chess::Chessboard;
+using chess::Column;
+using chess::Coordinate;
+using chess::Move;
+using chess::PieceType;
+using chess::Row;
+using chess::Side;
+
+void test_initial_position()
+{
+    const Chessboard chessboard = Chessboard::from_fen("rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR");
+    CHESS_SCORE_CALCULATOR_CHECK(chess::generate_moves(chessboard, Side::White).size() == 20);
+    CHESS_SCORE_CALCULATOR_CHECK(chess::generate_moves(chessboard, Side::Black).size() == 20);
+}
+
+void test_king_is_not_captured()
+{
+    // the queen and the pawn both threaten the black king
+    const Chessboard chessboard = Chessboard::from_fen("4k3/3PQ3/8/8/8/8/8/4K3");
+    const Coordinate king { Row::_8, Column::e };
+    const std::vector<Move> moves = chess::generate_moves(chessboard, Side::White);
+    CHESS_SCORE_CALCULATOR_CHECK(std::ranges::none_of(moves, [&king](const Move& move) { return move.to == king; }));
+    // the pawn still promotes at d8
+    CHESS_SCORE_CALCULATOR_CHECK(std::ranges::count_if(moves, [](const Move& move) { return move.from == Coordinate { Row::_7, Column::d }; }) == 4);
+}
+
+void test_promotions()
+{
+    const Chessboard chessboard = Chessboard::from_fen("4k3/P7/8/8/8/8/7p/4K3");
+    for (const Side side : { Side::White, Side::Black }) {
+        std::vector<PieceType> promotions;
+        for (const Move& move : chess::generate_moves(chessboard, side)) {
+            if (move.promotion) {
+                promotions.push_back(*move.promotion);
+            }
+        }
+        std::ranges::sort(promotions);
+        CHESS_SCORE_CALCULATOR_CHECK(promotions == (std::vector<PieceType> { PieceType::Knight, PieceType::Bishop, PieceType::Rook, PieceType::Queen }));
+    }
+}
+
+void test_to_string()
+{
+    CHESS_SCORE_CALCULATOR_CHECK(chess::to_string(Move { Coordinate { Row::_2, Column::e }, Coordinate { Row::_4, Column::e }, std::nullopt }) == "e2e4");
+    CHESS_SCORE_CALCULATOR_CHECK(chess::to_string(Move { Coordinate { Row::_7, Column::e }, Coordinate { Row::_8, Column::e }, PieceType::Queen }) == "e7e8q");
+    CHESS_SCORE_CALCULATOR_CHECK(chess::to_string(Move { Coordinate { Row::_2, Column::a }, Coordinate { Row::_1, Column::b }, PieceType::Knight }) == "a2b1n");
+}
+
+/// Every evaluation must match the board rebuilt after the move
+void test_evaluate_move()
+{
+    Chessboard chessboard = Chessboard::from_fen("r1bqk2r/pppp1ppp/2n2n2/2b1p3/2B1P3/3P1N2/PPP2PPP/RNBQK2R");
+    chessboard.build_attack_cache();
+    const chess::Score score = chessboard.score();
+    for (const Side side : { Side::White, Side::Black }) {
+        for (const Move& move : chess::generate_moves(chessboard, side)) {
+            const chess::MoveEvaluation evaluation = chess::evaluate_move(chessboard, score, side, move);
+            Chessboard moved = chessboard;
+            moved.make_move(move);
+            const chess::Score expected_score = Chessboard::from_packed(chess::pack(moved)).score();
+            const double advantage_before = (side == Side::White) ? (score.white - score.black) : (score.black - score.white);
+            const double advantage_after = (side == Side::White) ? (expected_score.white - expected_score.black) : (expected_score.black - expected_score.white);
+            CHESS_SCORE_CALCULATOR_CHECK((evaluation.move == move) && (evaluation.score.white == expected_score.white) && (evaluation.score.black == expected_score.black));
+            CHESS_SCORE_CALCULATOR_CHECK(evaluation.delta == advantage_after - advantage_before);
+        }
+    }
+    // the board is unchanged
+    CHESS_SCORE_CALCULATOR_CHECK((chessboard.score().white == score.white) && (chessboard.score().black == score.black));
+}
+
+void test_select_top_moves()
+{
+    const auto make_evaluations = [] {
+        std::vector<chess::MoveEvaluation> result;
+        for (const auto& [col, delta] : { std::pair { Column::a, 1.0 }, std::pair { Column::b, 3.0 }, std::pair { Column::c, 2.0 }, std::pair { Column::d, 3.0 } }) {
+            result.push_back(chess::MoveEvaluation { Move { Coordinate { Row::_2, col }, Coordinate { Row::_3, col }, std::nullopt }, chess::Score {}, delta });
+        }
+        return result;
+    };
+    const auto get_columns = [](const std::vector<chess::MoveEvaluation>& evaluations) {
+        std::vector<Column> result;
+        for (const chess::MoveEvaluation& evaluation : evaluations) {
+            result.push_back(evaluation.move.from.col);
+        }
+        return result;
+    };
+    // ties keep their order
+    std::vector<chess::MoveEvaluation> evaluations = make_evaluations();
+    chess::select_top_moves(evaluations, 0);
+    CHESS_SCORE_CALCULATOR_CHECK(get_columns(evaluations) == (std::vector<Column> { Column::b, Column::d, Column::c, Column::a }));
+    evaluations = make_evaluations();
+    chess::select_top_moves(evaluations, 2);
+    CHESS_SCORE_CALCULATOR_CHECK(get_columns(evaluations) == (std::vector<Column> { Column::b, Column::d }));
+    evaluations = make_evaluations();
+    chess::select_top_moves(evaluations, 10);
+    CHESS_SCORE_CALCULATOR_CHECK(evaluations.size() == 4);
+}
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////
+
+int main()
+{
+    return chess::test::run(test_initial_position, test_king_is_not_captured, test_promotions, test_to_string, test_evaluate_move, test_select_top_moves);
+}
@@ -0,0 +1,87 @@
+////////////////////////////////////////////////////////////////////////////////
+// Standard Libraries
+#include <filesystem>
+#include <fstream>
+#include <string_view>
+////////////////////////////////////////////////////////////////////////////////
+// User Defined Libraries
+#include "test.hpp"
+#include <chess_score_calculator/chessboard.hpp>
+#include <chess_score_calculator/enums.hpp>
+#include <chess_score_calculator/packed_board.hpp>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+constexpr std::string_view board1_fen = "rnbqkb1r/pp2pp1p/2p5/3n2p1/Q2P1B1P/2N5/PP2PPP1/R3KBNR";
+constexpr std::string_view endgame_fen = "8/5k2/8/3Q4/8/8/1K6/8";
+
+/// @returns Whether both boards have the same pieces at the same tiles
+bool is_same_board(const chess::Chessboard& lhs, const chess::Chessboard& rhs)
+{
+    bool result = true;
+    for (const chess::Side side : { chess::Side::White, chess::Side::Black }) {
+        result = result && (lhs.get_bitboard(side) == rhs.get_bitboard(side));
+    }
+    for (const chess::PieceType piece_type : { chess::PieceType::Pawn, chess::PieceType::Knight, chess::PieceType::Bishop, chess::PieceType::Rook, chess::PieceType::Queen, chess::PieceType::King }) {
+        result = result && (lhs.get_bitboard(piece_type) == rhs.get_bitboard(piece_type));
+    }
+    return result;
+}
+
+void test_round_trip()
+{
+    for (const std::string_view fen : { board1_fen, endgame_fen }) {
+        const chess::Chessboard chessboard = chess::Chessboard::from_fen(fen);
+        const chess::PackedBoard packed_board = chess::pack(chessboard);
+        CHESS_SCORE_CALCULATOR_CHECK(is_same_board(chess::Chessboard::from_packed(packed_board), chessboard));
+    }
+}
+
+void test_layout()
+{
+    // a1 is the low nibble of the first byte, a white rook is its type plus one
+    const chess::PackedBoard packed_board = chess::pack(chess::Chessboard::from_fen(board1_fen));
+    CHESS_SCORE_CALCULATOR_CHECK((packed_board.nibbles[0] & 0xF) == static_cast<unsigned>(chess::PieceType::Rook) + 1);
+    CHESS_SCORE_CALCULATOR_CHECK((packed_board.nibbles[0] >> 4) == 0);
+}
+
+void test_invalid_nibble()
+{
+    chess::PackedBoard packed_board = chess::pack(chess::Chessboard::from_fen(endgame_fen));
+    packed_board.nibbles[0] = 0x07;
+    CHESS_SCORE_CALCULATOR_CHECK_THROWS(chess::Chessboard::from_packed(packed_board));
+}
+
+void test_file()
+{
+    const std::filesystem::path file = std::filesystem::temp_directory_path() / "chess_score_calculator_packed_board_test.bin";
+    {
+        std::ofstream ofs(file, std::ios_base::binary);
+        for (const std::string_view fen : { board1_fen, endgame_fen }) {
+            const chess::PackedBoard packed_board = chess::pack(chess::Chessboard::from_fen(fen));
+            ofs.write(reinterpret_cast<const char*>(packed_board.nibbles.data()), packed_board.nibbles.size());
+        }
+    }
+    {
+        const chess::PackedBoardFile packed_boards(file);
+        CHESS_SCORE_CALCULATOR_CHECK(packed_boards.size() == 2);
+        CHESS_SCORE_CALCULATOR_CHECK(is_same_board(chess::Chessboard::from_packed(packed_boards[1]), chess::Chessboard::from_fen(endgame_fen)));
+    }
+    // a truncated record
+    {
+        std::ofstream ofs(file, std::ios_base::binary | std::ios_base::app);
+        ofs.put('\0');
+    }
+    CHESS_SCORE_CALCULATOR_CHECK_THROWS(chess::PackedBoardFile(file));
+    std::filesystem::remove(file);
+}
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////
+
+int main()
+{
+    return chess::test::run(test_round_trip, test_layout, test_invalid_nibble, test_file);
+}
@@ -0,0 +1,136 @@
+////////////////////////////////////////////////////////////////////////////////
+// Standard Libraries
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+////////////////////////////////////////////////////////////////////////////////
+// User Defined Libraries
+#include "test.hpp"
+#include <chess_score_calculator/chessboard.hpp>
+#include <chess_score_calculator/enums.hpp>
+#include <chess_score_calculator/packed_board.hpp>
+#include <chess_score_calculator/pgn_reader.hpp>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+using chess::Chessboard;
+using chess::Side;
+
+/// @returns Whether both boards have the same placement
+bool is_same_placement(const Chessboard& lhs, const Chessboard& rhs)
+{
+    return (lhs.get_bitboard(Side::White) == rhs.get_bitboard(Side::White)) && (lhs.get_bitboard(Side::Black) == rhs.get_bitboard(Side::Black)) && (lhs.get_hash() == rhs.get_hash());
+}
+
+/// @returns Whether the incrementally updated board has the score of the board rebuilt from its placement
+bool is_consistent(const Chessboard& chessboard)
+{
+    const chess::Score score = chessboard.score();
+    const chess::Score expected_score = Chessboard::from_packed(chess::pack(chessboard)).score();
+    return (score.white == expected_score.white) && (score.black == expected_score.black);
+}
+
+void test_reader()
+{
+    const std::string_view pgn = "[Event \"First\"]\n"
+                                 "[White \"A [bracket]\"]\n"
+                                 "\n"
+                                 "1. e4 {a comment} e5 2. Nf3 (2. f4 exf4) Nc6 $1 3. Bb5 a6 1-0\n"
+                                 "\n"
+                                 "[FEN \"4k3/8/8/8/8/8/8/4K3 w - - 0 1\"]\n"
+                                 "\n"
+                                 "1. Kd2 ; a rest of line comment\n"
+                                 "Kd7 *\n";
+    chess::PgnReader reader(pgn);
+    const std::optional<chess::PgnGame> first = reader.next();
+    CHESS_SCORE_CALCULATOR_CHECK(first && (first->game_number == 1) && first->fen.empty());
+    CHESS_SCORE_CALCULATOR_CHECK(first && (first->moves == std::vector<std::string_view> { "e4", "e5", "Nf3", "Nc6", "Bb5", "a6" }));
+    const std::optional<chess::PgnGame> second = reader.next();
+    CHESS_SCORE_CALCULATOR_CHECK(second && (second->game_number == 2) && (second->fen == "4k3/8/8/8/8/8/8/4K3 w - - 0 1"));
+    CHESS_SCORE_CALCULATOR_CHECK(second && (second->moves == std::vector<std::string_view> { "Kd2", "Kd7" }));
+    CHESS_SCORE_CALCULATOR_CHECK(!reader.next());
+    chess::PgnReader unterminated_comment("1. e4 {never closed\n");
+    CHESS_SCORE_CALCULATOR_CHECK_THROWS(unterminated_comment.next());
+}
+
+/// Replays the moves of a game, checking every position against a rebuilt board
+void test_replay()
+{
+    // castling by both sides, en passant, a capture promotion and a disambiguated knight move
+    const std::string_view pgn = "1. e4 Nf6 2. e5 d5 3. exd6 Nbd7 4. dxc7 e6 5. Nf3 Be7 6. Be2 O-O 7. O-O Nb6 8. cxd8=Q Rxd8 *\n";
+    chess::PgnReader reader(pgn);
+    const std::optional<chess::PgnGame> game = reader.next();
+    CHESS_SCORE_CALCULATOR_CHECK(game && (game->moves.size() == 16));
+    if (!game) {
+        return;
+    }
+    chess::GameReplay replay(*game);
+    while (replay.play_next_move()) {
+        CHESS_SCORE_CALCULATOR_CHECK(is_consistent(replay.get_chessboard()));
+    }
+    CHESS_SCORE_CALCULATOR_CHECK((replay.get_num_plies() == 16) && (replay.get_side_to_move() == Side::White));
+    const Chessboard expected = Chessboard::from_fen("r1br2k1/pp2bppp/1n2pn2/8/8/5N2/PPPPBPPP/RNBQ1RK1");
+    CHESS_SCORE_CALCULATOR_CHECK(is_same_placement(replay.get_chessboard(), expected));
+}
+
+void test_fen_tag()
+{
+    const std::string_view pgn = "[FEN \"4k3/8/8/8/8/8/8/4K3 b - - 0 1\"]\n\n1... Kd7 2. Kd2 *\n";
+    chess::PgnReader reader(pgn);
+    const std::optional<chess::PgnGame> game = reader.next();
+    CHESS_SCORE_CALCULATOR_CHECK(game.has_value());
+    if (!game) {
+        return;
+    }
+    chess::GameReplay replay(*game);
+    CHESS_SCORE_CALCULATOR_CHECK(replay.get_side_to_move() == Side::Black);
+    while (replay.play_next_move()) {
+    }
+    CHESS_SCORE_CALCULATOR_CHECK(is_same_placement(replay.get_chessboard(), Chessboard::from_fen("8/3k4/8/8/8/8/3K4/8")));
+}
+
+void test_to_move()
+{
+    // both knights reach d2, none reaches d4, and there is no rook to castle with
+    Chessboard chessboard = Chessboard::from_fen("4k3/8/8/8/8/8/8/1N2KN2");
+    CHESS_SCORE_CALCULATOR_CHECK_THROWS(chess::to_move(chessboard, Side::White, "Nd2"));
+    CHESS_SCORE_CALCULATOR_CHECK_THROWS(chess::to_move(chessboard, Side::White, "Nd4"));
+    CHESS_SCORE_CALCULATOR_CHECK_THROWS(chess::to_move(chessboard, Side::White, "O-O"));
+    const chess::Move move = chess::to_move(chessboard, Side::White, "Nbd2");
+    CHESS_SCORE_CALCULATOR_CHECK((move.from == chess::Coordinate { chess::Row::_1, chess::Column::b }) && (move.to == chess::Coordinate { chess::Row::_2, chess::Column::d }));
+    // both knights reach c3, but the one on e2 is pinned to the king
+    Chessboard pinned = Chessboard::from_fen("4r1k1/8/8/8/8/8/4N3/1N2K3");
+    const chess::Move unpinned_move = chess::to_move(pinned, Side::White, "Nc3");
+    CHESS_SCORE_CALCULATOR_CHECK(unpinned_move.from == (chess::Coordinate { chess::Row::_1, chess::Column::b }));
+    CHESS_SCORE_CALCULATOR_CHECK(is_same_placement(pinned, Chessboard::from_fen("4r1k1/8/8/8/8/8/4N3/1N2K3")));
+}
+
+void test_invalid_move()
+{
+    const std::string_view pgn = "1. e4 e5 2. Ke3 *\n";
+    chess::PgnReader reader(pgn);
+    const std::optional<chess::PgnGame> game = reader.next();
+    CHESS_SCORE_CALCULATOR_CHECK(game.has_value());
+    if (!game) {
+        return;
+    }
+    chess::GameReplay replay(*game);
+    CHESS_SCORE_CALCULATOR_CHECK(replay.play_next_move() && replay.play_next_move());
+    try {
+        replay.play_next_move();
+        CHESS_SCORE_CALCULATOR_CHECK(false);
+    } catch (const std::invalid_argument& e) {
+        CHESS_SCORE_CALCULATOR_CHECK(std::string_view(e.what()).ends_with(" at game 1 ply 3"));
+    }
+}
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////
+
+int main()
+{
+    return chess::test::run(test_reader, test_replay, test_fen_tag, test_to_move, test_invalid_move);
+}
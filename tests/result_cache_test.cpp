@@ -0,0 +1,131 @@
+////////////////////////////////////////////////////////////////////////////////
+// Standard Libraries
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <string>
+#include <string_view>
+////////////////////////////////////////////////////////////////////////////////
+// User Defined Libraries
+#include "test.hpp"
+#include <chess_score_calculator/result_cache.hpp>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+const std::filesystem::path directory = std::filesystem::temp_directory_path() / "chess_score_calculator_result_cache_test";
+const std::filesystem::path cache_file = directory / "scores.cache";
+
+/// Start a test case from an empty directory
+void reset_directory()
+{
+    std::filesystem::remove_all(directory);
+    std::filesystem::create_directories(directory);
+}
+
+void write_file(const std::filesystem::path& file, std::string_view content)
+{
+    std::ofstream ofs(file, std::ios_base::binary);
+    ofs << content;
+}
+
+chess::ResultCacheEntry make_entry(std::uint64_t hash, double white, double black)
+{
+    return chess::ResultCacheEntry { chess::FileStamp { 10, 20 }, hash, chess::Score { white, black } };
+}
+
+bool is_same_entry(const std::optional<chess::ResultCacheEntry>& entry, const chess::ResultCacheEntry& expected)
+{
+    return entry && (entry->file_stamp == expected.file_stamp) && (entry->hash == expected.hash) && (entry->score.white == expected.score.white)
+        && (entry->score.black == expected.score.black);
+}
+
+void test_round_trip()
+{
+    reset_directory();
+    // a line feed and a backslash in a path must not break the line format
+    const std::string plain_key = chess::ResultCache::get_key(directory / "plain.txt");
+    const std::string escaped_key = chess::ResultCache::get_key(directory / "line\nfeed\\n.txt");
+    write_file(plain_key, "");
+    write_file(escaped_key, "");
+    const chess::ResultCacheEntry plain_entry = make_entry(0xFEDCBA9876543210, 134.5, 133.5);
+    const chess::ResultCacheEntry escaped_entry = make_entry(1, 100, 0.5);
+    {
+        chess::ResultCache result_cache(cache_file);
+        CHESS_SCORE_CALCULATOR_CHECK(!result_cache.find(plain_key));
+        result_cache.insert(plain_key, plain_entry);
+        result_cache.insert(escaped_key, escaped_entry);
+        result_cache.save();
+    }
+    const chess::ResultCache result_cache(cache_file);
+    CHESS_SCORE_CALCULATOR_CHECK(is_same_entry(result_cache.find(plain_key), plain_entry));
+    CHESS_SCORE_CALCULATOR_CHECK(is_same_entry(result_cache.find(escaped_key), escaped_entry));
+    // no temporary file is left
+    size_t num_files = 0;
+    for ([[maybe_unused]] const auto& entry : std::filesystem::directory_iterator(directory)) {
+        num_files++;
+    }
+    CHESS_SCORE_CALCULATOR_CHECK(num_files == 3);
+}
+
+void test_merge()
+{
+    reset_directory();
+    const std::string kept_key = chess::ResultCache::get_key(directory / "kept.txt");
+    const std::string removed_key = chess::ResultCache::get_key(directory / "removed.txt");
+    const std::string inserted_key = chess::ResultCache::get_key(directory / "inserted.txt");
+    write_file(kept_key, "");
+    write_file(removed_key, "");
+    {
+        chess::ResultCache result_cache(cache_file);
+        result_cache.insert(kept_key, make_entry(1, 1, 1));
+        result_cache.insert(removed_key, make_entry(2, 2, 2));
+        result_cache.save();
+    }
+    std::filesystem::remove(removed_key);
+    {
+        // a later run over other files keeps the entries of the files that still exist
+        chess::ResultCache result_cache(cache_file);
+        result_cache.insert(inserted_key, make_entry(3, 3, 3));
+        result_cache.save();
+    }
+    const chess::ResultCache result_cache(cache_file);
+    CHESS_SCORE_CALCULATOR_CHECK(is_same_entry(result_cache.find(kept_key), make_entry(1, 1, 1)));
+    CHESS_SCORE_CALCULATOR_CHECK(!result_cache.find(removed_key));
+    CHESS_SCORE_CALCULATOR_CHECK(is_same_entry(result_cache.find(inserted_key), make_entry(3, 3, 3)));
+}
+
+void test_file_format()
+{
+    reset_directory();
+    write_file(cache_file, "# chess_score_calculator result cache 2\n10 20 ff 2 3 /a\\nb\n");
+    CHESS_SCORE_CALCULATOR_CHECK(is_same_entry(chess::ResultCache(cache_file).find("/a\nb"), make_entry(0xFF, 1, 1.5)));
+    // an empty file, an invalid header, another version, a missing key, a non-numeric field, an invalid escape
+    for (const std::string_view content : {
+             "",
+             "# other file\n10 20 ff 2 3 /a\n",
+             "# chess_score_calculator result cache 20\n10 20 ff 2 3 /a\n",
+             "# chess_score_calculator result cache 2\n10 20 ff 2 3 /a\n10 20 ff 2 3\n",
+             "# chess_score_calculator result cache 2\n10 20 ff 2 3 /a\n10 x ff 2 3 /b\n",
+             "# chess_score_calculator result cache 2\n10 20 ff 2 3 /a\n10 20 ff 2 3 /b\\t\n",
+         }) {
+        write_file(cache_file, content);
+        // the invalid file is an empty cache, and saving replaces it
+        chess::ResultCache result_cache(cache_file);
+        CHESS_SCORE_CALCULATOR_CHECK(!result_cache.find("/a"));
+        result_cache.save();
+        CHESS_SCORE_CALCULATOR_CHECK(std::filesystem::file_size(cache_file) == std::string_view("# chess_score_calculator result cache 2\n").size());
+    }
+}
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////
+
+int main()
+{
+    const int result = chess::test::run(test_round_trip, test_merge, test_file_format);
+    std::filesystem::remove_all(directory);
+    return result;
+}
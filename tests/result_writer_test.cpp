@@ -0,0 +1,114 @@
+////////////////////////////////////////////////////////////////////////////////
+// Standard Libraries
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <optional>
+#include <string>
+#include <string_view>
+////////////////////////////////////////////////////////////////////////////////
+// User Defined Libraries
+#include "test.hpp"
+#include <chess_score_calculator/chessboard.hpp>
+#include <chess_score_calculator/result_writer.hpp>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+const std::filesystem::path output_file = std::filesystem::temp_directory_path() / "chess_score_calculator_result_writer_test.txt";
+
+std::string read_output()
+{
+    std::ifstream ifs(output_file, std::ios_base::binary);
+    return std::string(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+}
+
+/// @returns Output of a writer with a row of given name and scores 134.5 and 64, and the delta if any
+std::string write_row(chess::OutputFormat output_format, std::string_view filename, std::optional<double> delta = std::nullopt, size_t filename_column_width = 0)
+{
+    chess::ResultWriter result_writer(output_format, filename_column_width, output_file, false, delta.has_value());
+    if (delta) {
+        result_writer.write_row(filename, chess::Score { 134.5, 64 }, *delta);
+    } else {
+        result_writer.write_row(filename, chess::Score { 134.5, 64 });
+    }
+    result_writer.close();
+    return read_output();
+}
+
+void test_table()
+{
+    CHESS_SCORE_CALCULATOR_CHECK(write_row(chess::OutputFormat::Table, "board1.txt")
+        == "| Chessboard filename | White | Black |\n"
+           "| ------------------- | ----- | ----- |\n"
+           "| board1.txt          | 134.5 | 64    |\n");
+    // a wider column fits longer names, a name longer than the column only widens its own row
+    CHESS_SCORE_CALCULATOR_CHECK(write_row(chess::OutputFormat::Table, "boards/board1.txt", std::nullopt, 21)
+        == "| Chessboard filename   | White | Black |\n"
+           "| --------------------- | ----- | ----- |\n"
+           "| boards/board1.txt     | 134.5 | 64    |\n");
+    CHESS_SCORE_CALCULATOR_CHECK(write_row(chess::OutputFormat::Table, "a/very/long/path/to/board1.txt")
+        == "| Chessboard filename | White | Black |\n"
+           "| ------------------- | ----- | ----- |\n"
+           "| a/very/long/path/to/board1.txt | 134.5 | 64    |\n");
+    CHESS_SCORE_CALCULATOR_CHECK(write_row(chess::OutputFormat::Table, "e2e4", -3.5)
+        == "| Chessboard filename | White | Black | Delta |\n"
+           "| ------------------- | ----- | ----- | ----- |\n"
+           "| e2e4                | 134.5 | 64    | -3.5  |\n");
+}
+
+void test_csv()
+{
+    CHESS_SCORE_CALCULATOR_CHECK(write_row(chess::OutputFormat::Csv, "board1.txt") == "filename,white,black\nboard1.txt,134.5,64\n");
+    // fields with a separator, a quote or a line break are quoted, and quotes are doubled
+    CHESS_SCORE_CALCULATOR_CHECK(write_row(chess::OutputFormat::Csv, "a,b.txt") == "filename,white,black\n\"a,b.txt\",134.5,64\n");
+    CHESS_SCORE_CALCULATOR_CHECK(write_row(chess::OutputFormat::Csv, "a\"b.txt") == "filename,white,black\n\"a\"\"b.txt\",134.5,64\n");
+    CHESS_SCORE_CALCULATOR_CHECK(write_row(chess::OutputFormat::Csv, "a\nb.txt") == "filename,white,black\n\"a\nb.txt\",134.5,64\n");
+    CHESS_SCORE_CALCULATOR_CHECK(write_row(chess::OutputFormat::Csv, "e7e8q", 8) == "filename,white,black,delta\ne7e8q,134.5,64,8\n");
+}
+
+void test_json_lines()
+{
+    CHESS_SCORE_CALCULATOR_CHECK(write_row(chess::OutputFormat::JsonLines, "board1.txt") == "{\"filename\":\"board1.txt\",\"white\":134.5,\"black\":64}\n");
+    // quotes, backslashes and control characters are escaped
+    CHESS_SCORE_CALCULATOR_CHECK(write_row(chess::OutputFormat::JsonLines, std::string_view("a\"\\\n\r\t\x01\x1f.txt"))
+        == "{\"filename\":\"a\\\"\\\\\\n\\r\\t\\u0001\\u001f.txt\",\"white\":134.5,\"black\":64}\n");
+    CHESS_SCORE_CALCULATOR_CHECK(write_row(chess::OutputFormat::JsonLines, "e2e4", 0.5) == "{\"filename\":\"e2e4\",\"white\":134.5,\"black\":64,\"delta\":0.5}\n");
+}
+
+void test_output_format()
+{
+    for (const chess::OutputFormat output_format : { chess::OutputFormat::Table, chess::OutputFormat::Csv, chess::OutputFormat::JsonLines }) {
+        CHESS_SCORE_CALCULATOR_CHECK(chess::to_output_format(chess::to_string(output_format)) == output_format);
+    }
+    CHESS_SCORE_CALCULATOR_CHECK_THROWS(chess::to_output_format("json"));
+}
+
+/// Rows beyond the buffer are written as the buffer fills, and every row is kept
+void test_many_rows()
+{
+    constexpr size_t num_rows = 100000;
+    {
+        chess::ResultWriter result_writer(chess::OutputFormat::Csv, 0, output_file, false);
+        for (size_t i = 0; i < num_rows; i++) {
+            result_writer.write_row("board" + std::to_string(i) + ".txt", chess::Score { 1, 2 });
+        }
+        result_writer.close();
+    }
+    const std::string output = read_output();
+    CHESS_SCORE_CALCULATOR_CHECK(static_cast<size_t>(std::ranges::count(output, '\n')) == num_rows + 1);
+    CHESS_SCORE_CALCULATOR_CHECK(output.ends_with("board99999.txt,1,2\n"));
+    CHESS_SCORE_CALCULATOR_CHECK_THROWS(chess::ResultWriter(chess::OutputFormat::Csv, 0, output_file / "missing" / "result.csv", false));
+}
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////
+
+int main()
+{
+    const int result = chess::test::run(test_table, test_csv, test_json_lines, test_output_format, test_many_rows);
+    std::filesystem::remove(output_file);
+    return result;
+}
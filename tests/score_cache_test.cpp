@@ -0,0 +1,84 @@
+////////////////////////////////////////////////////////////////////////////////
+// Standard Libraries
+#include <cstdint>
+#include <optional>
+#include <string_view>
+////////////////////////////////////////////////////////////////////////////////
+// User Defined Libraries
+#include "test.hpp"
+#include <chess_score_calculator/chessboard.hpp>
+#include <chess_score_calculator/packed_board.hpp>
+#include <chess_score_calculator/score_cache.hpp>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+/// Board 1 of the README, whose scores are 134.5 and 133.5
+constexpr std::string_view board1_denotation = "ks as fs vs ss fs -- ks\n"
+                                               "ps ps -- -- ps ps -- ps\n"
+                                               "-- -- ps -- -- -- -- --\n"
+                                               "-- -- -- as -- -- ps --\n"
+                                               "vb -- -- pb -- fb -- pb\n"
+                                               "-- -- ab -- -- -- -- --\n"
+                                               "pb pb -- -- pb pb pb --\n"
+                                               "kb -- -- -- sb fb ab kb\n";
+constexpr std::string_view board1_fen = "rnbqkb1r/pp2pp1p/2p5/3n2p1/Q2P1B1P/2N5/PP2PPP1/R3KBNR";
+
+bool is_same_score(const std::optional<chess::Score>& score, const chess::Score& expected)
+{
+    return score && (score->white == expected.white) && (score->black == expected.black);
+}
+
+void test_hash()
+{
+    const chess::Chessboard from_string = chess::Chessboard::from_string(board1_denotation);
+    const chess::Chessboard from_fen = chess::Chessboard::from_fen(board1_fen);
+    const chess::Chessboard from_packed = chess::Chessboard::from_packed(chess::pack(from_string));
+    CHESS_SCORE_CALCULATOR_CHECK(from_string.get_hash() != 0);
+    CHESS_SCORE_CALCULATOR_CHECK((from_string.get_hash() == from_fen.get_hash()) && (from_string.get_hash() == from_packed.get_hash()));
+    // a piece of the other side, or the same piece at another tile, is another position
+    CHESS_SCORE_CALCULATOR_CHECK(chess::Chessboard::from_fen("4k3/8/8/8/8/8/8/4K3").get_hash() != chess::Chessboard::from_fen("4K3/8/8/8/8/8/8/4k3").get_hash());
+    CHESS_SCORE_CALCULATOR_CHECK(chess::Chessboard::from_fen("4k3/8/8/8/8/8/8/4K3").get_hash() != chess::Chessboard::from_fen("3k4/8/8/8/8/8/8/4K3").get_hash());
+}
+
+void test_hits_and_misses()
+{
+    chess::ScoreCache score_cache(3);
+    CHESS_SCORE_CALCULATOR_CHECK(score_cache.get_num_entries() == 4);
+    const chess::Chessboard chessboard = chess::Chessboard::from_string(board1_denotation);
+    const chess::Score expected_score { 134.5, 133.5 };
+    CHESS_SCORE_CALCULATOR_CHECK(!score_cache.find(chessboard.get_hash()));
+    CHESS_SCORE_CALCULATOR_CHECK(is_same_score(score_cache.score(chessboard), expected_score));
+    CHESS_SCORE_CALCULATOR_CHECK(is_same_score(score_cache.score(chess::Chessboard::from_fen(board1_fen)), expected_score));
+    CHESS_SCORE_CALCULATOR_CHECK(is_same_score(score_cache.find(chessboard.get_hash()), expected_score));
+    // the first find and the first score call missed
+    CHESS_SCORE_CALCULATOR_CHECK((score_cache.get_num_hits() == 2) && (score_cache.get_num_misses() == 2));
+}
+
+void test_replacement()
+{
+    chess::ScoreCache score_cache(4);
+    // both hashes have the same index, the newer entry replaces the older one
+    const std::uint64_t older_hash = 0x1000000000000001;
+    const std::uint64_t newer_hash = 0x2000000000000001;
+    score_cache.insert(older_hash, chess::Score { 1, 2 });
+    CHESS_SCORE_CALCULATOR_CHECK(is_same_score(score_cache.find(older_hash), chess::Score { 1, 2 }));
+    score_cache.insert(newer_hash, chess::Score { 3.5, 0 });
+    CHESS_SCORE_CALCULATOR_CHECK(!score_cache.find(older_hash));
+    CHESS_SCORE_CALCULATOR_CHECK(is_same_score(score_cache.find(newer_hash), chess::Score { 3.5, 0 }));
+    // other indices are unaffected
+    score_cache.insert(2, chess::Score { 5, 6 });
+    CHESS_SCORE_CALCULATOR_CHECK(is_same_score(score_cache.find(newer_hash), chess::Score { 3.5, 0 }));
+    CHESS_SCORE_CALCULATOR_CHECK(is_same_score(score_cache.find(2), chess::Score { 5, 6 }));
+    // an empty entry never matches, even for the hash 0
+    CHESS_SCORE_CALCULATOR_CHECK(!chess::ScoreCache(4).find(0));
+}
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////
+
+int main()
+{
+    return chess::test::run(test_hash, test_hits_and_misses, test_replacement);
+}
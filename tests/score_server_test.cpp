@@ -0,0 +1,212 @@
+////////////////////////////////////////////////////////////////////////////////
+// Standard Libraries
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+#ifdef __linux__
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+////////////////////////////////////////////////////////////////////////////////
+// User Defined Libraries
+#include "test.hpp"
+#include <chess_score_calculator/score_cache.hpp>
+#include <chess_score_calculator/score_server.hpp>
+#include <chess_score_calculator/thread_pool.hpp>
+////////////////////////////////////////////////////////////////////////////////
+
+#ifdef __linux__
+
+namespace {
+
+const std::filesystem::path socket_path = std::filesystem::temp_directory_path() / "chess_score_calculator_score_server_test.sock";
+
+/// Board 1 of the README, whose scores are 134.5 and 133.5
+constexpr std::string_view board1_request = "ks as fs vs ss fs -- ks\n"
+                                            "ps ps -- -- ps ps -- ps\n"
+                                            "-- -- ps -- -- -- -- --\n"
+                                            "-- -- -- as -- -- ps --\n"
+                                            "vb -- -- pb -- fb -- pb\n"
+                                            "-- -- ab -- -- -- -- --\n"
+                                            "pb pb -- -- pb pb pb --\n"
+                                            "kb -- -- -- sb fb ab kb\n"
+                                            "\n";
+constexpr std::string_view board1_fen_request = "rnbqkb1r/pp2pp1p/2p5/3n2p1/Q2P1B1P/2N5/PP2PPP1/R3KBNR w KQkq - 0 1\n\n";
+constexpr std::string_view board1_response = "134.5 133.5";
+
+/// Blocking client connection to the server
+class Client {
+public:
+    Client()
+        : fd(::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0))
+    {
+        sockaddr_un address {};
+        address.sun_family = AF_UNIX;
+        std::memcpy(address.sun_path, socket_path.c_str(), socket_path.native().size() + 1);
+        is_connected = (fd != -1) && (::connect(fd, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) == 0);
+    }
+
+    ~Client()
+    {
+        if (fd != -1) {
+            ::close(fd);
+        }
+    }
+
+    Client(const Client&) = delete;
+    Client& operator=(const Client&) = delete;
+
+    /// @returns Whether every byte is sent
+    bool send(std::string_view data)
+    {
+        while (!data.empty()) {
+            const ssize_t size = ::send(fd, data.data(), data.size(), MSG_NOSIGNAL);
+            if (size <= 0) {
+                return false;
+            }
+            data.remove_prefix(static_cast<size_t>(size));
+        }
+        return true;
+    }
+
+    /// @returns Next response line without its line feed, empty if the server closed the connection
+    std::optional<std::string> receive_line()
+    {
+        while (input.find('\n') == std::string::npos) {
+            char buffer[4096];
+            const ssize_t size = ::recv(fd, buffer, sizeof(buffer), 0);
+            if (size <= 0) {
+                return std::nullopt;
+            }
+            input.append(buffer, static_cast<size_t>(size));
+        }
+        const size_t end = input.find('\n');
+        std::string result = input.substr(0, end);
+        input.erase(0, end + 1);
+        return result;
+    }
+
+    bool is_connected = false;
+
+private:
+    int fd;
+    std::string input;
+};
+
+void test_requests()
+{
+    Client client;
+    CHESS_SCORE_CALCULATOR_CHECK(client.is_connected);
+    CHESS_SCORE_CALCULATOR_CHECK(client.send(board1_request) && (client.receive_line() == board1_response));
+    CHESS_SCORE_CALCULATOR_CHECK(client.send(board1_fen_request) && (client.receive_line() == board1_response));
+    // carriage returns and extra empty lines between requests are accepted
+    CHESS_SCORE_CALCULATOR_CHECK(client.send("\r\n4k3/8/8/8/8/8/8/4K3\r\n\r\n") && (client.receive_line() == "100 100"));
+    CHESS_SCORE_CALCULATOR_CHECK(client.send("xx\n\n"));
+    const std::optional<std::string> response = client.receive_line();
+    CHESS_SCORE_CALCULATOR_CHECK(response && response->starts_with("error: "));
+    // the connection is still usable after an error
+    CHESS_SCORE_CALCULATOR_CHECK(client.send(board1_fen_request) && (client.receive_line() == board1_response));
+}
+
+/// Requests sent at once are answered in order, although they are scored in parallel
+void test_pipelining()
+{
+    Client client;
+    std::string requests;
+    std::vector<std::string> expected_responses;
+    for (int i = 0; i < 200; i++) {
+        if (i % 3 == 0) {
+            requests += board1_request;
+            expected_responses.emplace_back(board1_response);
+        } else if (i % 3 == 1) {
+            requests += "4k3/8/8/8/8/8/8/4K3\n\n";
+            expected_responses.emplace_back("100 100");
+        } else {
+            requests += "4k3/8/8/8/8/8/8/3QK3\n\n";
+            expected_responses.emplace_back("109 100");
+        }
+    }
+    CHESS_SCORE_CALCULATOR_CHECK(client.send(requests));
+    bool is_in_order = true;
+    for (const std::string& expected_response : expected_responses) {
+        is_in_order = is_in_order && (client.receive_line() == expected_response);
+    }
+    CHESS_SCORE_CALCULATOR_CHECK(is_in_order);
+}
+
+/// A client that sends far more requests than the server keeps before reading still gets every response
+void test_backpressure()
+{
+    constexpr int num_requests = 20000;
+    Client client;
+    std::thread sender([&client] {
+        for (int i = 0; i < num_requests; i++) {
+            client.send(board1_fen_request);
+        }
+    });
+    // start receiving late, so the server stops reading the connection meanwhile
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    int num_responses = 0;
+    while ((num_responses < num_requests) && (client.receive_line() == board1_response)) {
+        num_responses++;
+    }
+    sender.join();
+    CHESS_SCORE_CALCULATOR_CHECK(num_responses == num_requests);
+}
+
+/// A request that never ends closes its connection
+void test_oversize_request()
+{
+    Client client;
+    const std::string line = "-- -- -- -- -- -- -- --\n";
+    std::string request;
+    while (request.size() <= 128 * 1024) {
+        request += line;
+    }
+    // the server may close the connection before every byte is sent
+    client.send(request);
+    CHESS_SCORE_CALCULATOR_CHECK(!client.receive_line());
+    // other connections are unaffected
+    Client other_client;
+    CHESS_SCORE_CALCULATOR_CHECK(other_client.send(board1_request) && (other_client.receive_line() == board1_response));
+}
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////
+
+int main()
+{
+    chess::ThreadPool thread_pool(4);
+    chess::ScoreCache score_cache(1024);
+    int result = EXIT_FAILURE;
+    {
+        chess::ScoreServer score_server(socket_path, thread_pool, &score_cache);
+        std::thread server_thread([&score_server] { score_server.run(); });
+        result = chess::test::run(test_requests, test_pipelining, test_backpressure, test_oversize_request);
+        score_server.stop();
+        server_thread.join();
+    }
+    // the socket file is removed with the server
+    if (std::filesystem::exists(socket_path)) {
+        result = EXIT_FAILURE;
+    }
+    return result;
+}
+
+#else
+
+int main()
+{
+    // the server is only available on Linux
+    return EXIT_SUCCESS;
+}
+
+#endif
@@ -0,0 +1,65 @@
+#ifndef CHESS_SCORE_CALCULATOR_TEST_HPP
+#define CHESS_SCORE_CALCULATOR_TEST_HPP
+
+////////////////////////////////////////////////////////////////////////////////
+// Standard Libraries
+#include <cstdlib>
+#include <exception>
+#include <iostream>
+#include <string_view>
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+Assertion macros of the regression tests, a failed check is reported and the test goes on
+
+CHESS_SCORE_CALCULATOR_CHECK(condition) checks that the condition holds.
+CHESS_SCORE_CALCULATOR_CHECK_THROWS(expression) checks that evaluating the expression throws.
+*/
+#define CHESS_SCORE_CALCULATOR_CHECK(condition) ::chess::test::check(static_cast<bool>(condition), #condition, __FILE__, __LINE__)
+#define CHESS_SCORE_CALCULATOR_CHECK_THROWS(expression)                                 \
+    do {                                                                               \
+        bool is_thrown = false;                                                        \
+        try {                                                                          \
+            static_cast<void>(expression);                                             \
+        } catch (const std::exception&) {                                              \
+            is_thrown = true;                                                          \
+        }                                                                              \
+        ::chess::test::check(is_thrown, "throws " #expression, __FILE__, __LINE__); \
+    } while (false)
+
+namespace chess::test {
+
+/// Failed checks of the test executable
+inline int num_failures = 0;
+
+inline void check(bool condition, std::string_view description, std::string_view file, int line)
+{
+    if (!condition) {
+        num_failures++;
+        std::cerr << file << ":" << line << ": check failed: " << description << std::endl;
+    }
+}
+
+/**
+Run the test cases of an executable, an exception fails the case that throws it
+
+@returns Exit code of the executable
+*/
+template <typename... TestCases>
+int run(TestCases... test_cases)
+{
+    const auto run_case = [](auto test_case) {
+        try {
+            test_case();
+        } catch (const std::exception& e) {
+            num_failures++;
+            std::cerr << "unexpected exception: " << e.what() << std::endl;
+        }
+    };
+    (run_case(test_cases), ...);
+    return (num_failures == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+} // namespace chess::test
+
+#endif // CHESS_SCORE_CALCULATOR_TEST_HPP
@@ -0,0 +1,96 @@
+////////////////////////////////////////////////////////////////////////////////
+// Standard Libraries
+#include <atomic>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+////////////////////////////////////////////////////////////////////////////////
+// User Defined Libraries
+#include "test.hpp"
+#include <chess_score_calculator/thread_pool.hpp>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+/// Tasks that submit more tasks, wait must cover the whole tree
+void test_nested_submit()
+{
+    chess::ThreadPool pool(4);
+    std::atomic<int> num_leaves = 0;
+    for (int round = 0; round < 50; round++) {
+        for (int i = 0; i < 8; i++) {
+            pool.submit([&pool, &num_leaves] {
+                for (int j = 0; j < 8; j++) {
+                    pool.submit([&num_leaves] { num_leaves++; });
+                }
+            });
+        }
+        pool.wait();
+        CHESS_SCORE_CALCULATOR_CHECK(num_leaves == (round + 1) * 64);
+    }
+}
+
+void test_parallel_for()
+{
+    for (const unsigned num_threads : { 1u, 3u, 8u }) {
+        chess::ThreadPool pool(num_threads);
+        for (const size_t count : { size_t { 0 }, size_t { 1 }, size_t { 7 }, size_t { 10000 } }) {
+            std::vector<std::atomic<int>> num_calls(count);
+            chess::parallel_for(pool, count, [&num_calls](size_t i) { num_calls[i]++; });
+            bool is_each_called_once = true;
+            for (const std::atomic<int>& num_call : num_calls) {
+                is_each_called_once = is_each_called_once && (num_call == 1);
+            }
+            CHESS_SCORE_CALCULATOR_CHECK(is_each_called_once);
+        }
+    }
+}
+
+void test_exception()
+{
+    chess::ThreadPool pool(4);
+    std::atomic<int> num_finished = 0;
+    for (int i = 0; i < 100; i++) {
+        pool.submit([&num_finished, i] {
+            if (i % 10 == 3) {
+                throw std::runtime_error("task failed");
+            }
+            num_finished++;
+        });
+    }
+    // the other tasks still run, and the exception is thrown once
+    CHESS_SCORE_CALCULATOR_CHECK_THROWS(pool.wait());
+    CHESS_SCORE_CALCULATOR_CHECK(num_finished == 90);
+    pool.wait();
+    CHESS_SCORE_CALCULATOR_CHECK_THROWS(chess::parallel_for(pool, 1000, [](size_t i) {
+        if (i == 500) {
+            throw std::invalid_argument("invalid index");
+        }
+    }));
+    // the pool is usable afterwards
+    std::atomic<size_t> sum = 0;
+    chess::parallel_for(pool, 100, [&sum](size_t i) { sum += i; });
+    CHESS_SCORE_CALCULATOR_CHECK(sum == 4950);
+}
+
+/// The destructor finishes the queued tasks
+void test_destructor()
+{
+    std::atomic<int> num_finished = 0;
+    {
+        chess::ThreadPool pool(2);
+        for (int i = 0; i < 1000; i++) {
+            pool.submit([&num_finished] { num_finished++; });
+        }
+    }
+    CHESS_SCORE_CALCULATOR_CHECK(num_finished == 1000);
+}
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////
+
+int main()
+{
+    return chess::test::run(test_nested_submit, test_parallel_for, test_exception, test_destructor);
+}
@@ -0,0 +1,37 @@
+# Runs the watch mode at a directory that holds its own result.txt, which must not be rescored as a board file.
+# Usage: cmake -DCALCULATOR=<chess_score_calculator> -DBOARD_DIRECTORY=<res> -DWORK_DIRECTORY=<directory> -P watch_mode_test.cmake
+
+file(REMOVE_RECURSE "${WORK_DIRECTORY}")
+file(GLOB board_files "${BOARD_DIRECTORY}/*.txt")
+file(COPY ${board_files} DESTINATION "${WORK_DIRECTORY}")
+# a table of a previous run is not a board either
+file(WRITE "${WORK_DIRECTORY}/result.txt" "stale table\n")
+
+# the watch mode runs until it is killed
+execute_process(
+    COMMAND "${CALCULATOR}" --watch .
+    WORKING_DIRECTORY "${WORK_DIRECTORY}"
+    TIMEOUT 3
+    OUTPUT_VARIABLE output
+    ERROR_VARIABLE error
+)
+if (error MATCHES "Skipped")
+    message(FATAL_ERROR "The watch mode scored its own output:\n${error}")
+endif()
+file(READ "${WORK_DIRECTORY}/result.txt" result)
+foreach (board_file ${board_files})
+    get_filename_component(board_name "${board_file}" NAME)
+    if (NOT result MATCHES "${board_name}")
+        message(FATAL_ERROR "Missing ${board_name} at result.txt:\n${result}")
+    endif()
+endforeach()
+if ((result MATCHES "result.txt") OR (result MATCHES "stale"))
+    message(FATAL_ERROR "Unexpected row at result.txt:\n${result}")
+endif()
+# the table is written once, rewriting it would rescore nothing but still print a table per pass
+string(REGEX MATCHALL "board1.txt" rows "${output}")
+list(LENGTH rows num_rows)
+if (NOT num_rows EQUAL 1)
+    message(FATAL_ERROR "The watch mode printed ${num_rows} tables:\n${output}")
+endif()
+file(REMOVE_RECURSE "${WORK_DIRECTORY}")